@@ -0,0 +1,132 @@
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "async_fill.h"
+#include "my_vector.h"
+#include "bench_util.h"
+
+namespace
+{
+    constexpr std::size_t chunk_bytes = std::size_t{ 1 } << 20;
+
+    std::size_t parse_lines(my_vector<std::int64_t>& vec, my_span<const char> bytes, bool atEnd)
+    {
+        const char* const begin = bytes.data();
+        const char* const end = begin + bytes.size();
+        const char* line = begin;
+        for (const char* it = begin; it != end; ++it)
+        {
+            if (*it == '\n')
+            {
+                std::int64_t value = 0;
+                std::from_chars(line, it, value);
+                vec.push_back(value);
+                line = it + 1;
+            }
+        }
+        if (atEnd && line != end)
+        {
+            std::int64_t value = 0;
+            std::from_chars(line, end, value);
+            vec.push_back(value);
+            line = end;
+        }
+        return static_cast<std::size_t>(line - begin);
+    }
+
+    // Drops the file from the page cache, so that every load reads it from the device.
+    void evict(const char* path)
+    {
+        const int fd = open(path, O_RDONLY);
+        fdatasync(fd);
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+    }
+
+    // The loop async_fill replaces: read a chunk, parse it, read the next.
+    void load_blocking(const char* path, my_vector<std::int64_t>& vec)
+    {
+        const int fd = open(path, O_RDONLY);
+        my_vector<char> buffer;
+        buffer.resize(2 * chunk_bytes);
+        std::size_t carry = 0;
+        for (;;)
+        {
+            const ssize_t read = ::read(fd, buffer.data() + carry, chunk_bytes);
+            const std::size_t bytes = carry + static_cast<std::size_t>(read > 0 ? read : 0);
+            const std::size_t consumed = parse_lines(vec, my_span<const char>(buffer.data(), bytes), read <= 0);
+            carry = bytes - consumed;
+            std::memmove(buffer.data(), buffer.data() + consumed, carry);
+            if (read <= 0)
+            {
+                break;
+            }
+        }
+        close(fd);
+    }
+
+    template <typename Load>
+    void bench_load(const std::string& name, const char* path, std::size_t fileBytes, Load load)
+    {
+        evict(path);
+        my_vector<std::int64_t> vec;
+        const auto start = bench_clock::now();
+        load(vec);
+        const double seconds = seconds_since(start);
+        do_not_optimize(vec.data());
+        report(name, seconds * 1e3, "ms");
+        report(name + "/throughput", static_cast<double>(fileBytes) / seconds / 1e6, "MB/s");
+    }
+}
+
+// Usage: bench_async_fill [file size in MiB, default 256] [file path, default in /tmp]
+// Loads a file of one number per line, evicted from the page cache first, with a blocking read
+// loop and with async_fill on each backend. The gap is how much of the I/O the parsing hides,
+// so it depends on the device and is reported but not checked.
+int main(int argc, char** argv)
+{
+    const std::size_t fileBytes = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 256) << 20;
+    const std::string path = argc > 2 ? argv[2] : "/tmp/bench_async_fill.txt";
+
+    {
+        std::FILE* file = std::fopen(path.c_str(), "w");
+        std::uint64_t state = 11;
+        for (std::size_t written = 0; written < fileBytes;)
+        {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            written += static_cast<std::size_t>(std::fprintf(file, "%llu\n", static_cast<unsigned long long>(state >> 20)));
+        }
+        std::fclose(file);
+    }
+
+    bench_load("load/blocking_read", path.c_str(), fileBytes, [&](my_vector<std::int64_t>& vec)
+    {
+        load_blocking(path.c_str(), vec);
+    });
+    for (const auto& [name, backend] : { std::pair{ "load/async_fill_io_uring", read_backend::io_uring }, std::pair{ "load/async_fill_thread_pool", read_backend::thread_pool } })
+    {
+        try
+        {
+            bench_load(name, path.c_str(), fileBytes, [&](my_vector<std::int64_t>& vec)
+            {
+                file_source source(path.c_str(), chunk_bytes, 2, backend);
+                async_fill(vec, source, parse_lines).get();
+            });
+        }
+        catch (const async_fill_error& e)
+        {
+            std::printf("%s: skipped, error %d\n", name, e.error());
+        }
+    }
+
+    std::remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,83 @@
+#include <cstdlib>
+#include <algorithm>
+#include <string>
+
+#include "devector.h"
+#include "my_vector.h"
+#include "bench_util.h"
+
+namespace
+{
+    template <typename F>
+    void bench_one(const std::string& name, std::size_t operations, F f)
+    {
+        f();
+        const auto start = bench_clock::now();
+        f();
+        report(name, seconds_since(start) * 1e9 / operations, "ns/op");
+    }
+}
+
+// Usage: bench_devector [elements, default 1048576]
+// my_vector's front insertion is quadratic, so it only gets a 16384-element run.
+int main(int argc, char** argv)
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t{ 1 } << 20;
+    const std::size_t quadraticN = std::min<std::size_t>(n, 1 << 14);
+
+    bench_one("push_front/my_vector_insert", quadraticN, [quadraticN]()
+    {
+        my_vector<int> vec;
+        for (std::size_t i = 0; i < quadraticN; ++i)
+        {
+            vec.insert(vec.cbegin(), static_cast<int>(i));
+        }
+        do_not_optimize(vec.data());
+    });
+
+    bench_one("push_front/devector", n, [n]()
+    {
+        devector<int> vec;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            vec.push_front(static_cast<int>(i));
+        }
+        do_not_optimize(vec.data());
+    });
+
+    bench_one("push_back/devector", n, [n]()
+    {
+        devector<int> vec;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            vec.push_back(static_cast<int>(i));
+        }
+        do_not_optimize(vec.data());
+    });
+
+    // Work queue: a standing backlog of 1024 tasks, new work pushed at the front and the
+    // oldest task taken from the back.
+    bench_one("queue/my_vector_insert", quadraticN, [quadraticN]()
+    {
+        my_vector<std::string> queue(1024, std::string(24, 'x'));
+        for (std::size_t i = 0; i < quadraticN; ++i)
+        {
+            queue.insert(queue.cbegin(), std::string(24, 'y'));
+            queue.pop_back();
+        }
+        do_not_optimize(queue.data());
+    });
+
+    bench_one("queue/devector", n, [n]()
+    {
+        devector<std::string> queue(1024, std::string(24, 'x'));
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            queue.push_front(std::string(24, 'y'));
+            queue.pop_back();
+        }
+        do_not_optimize(queue.data());
+    });
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include <cstdlib>
+#include <algorithm>
+#include <string>
+
+#include "gap_vector.h"
+#include "my_vector.h"
+#include "bench_util.h"
+
+namespace
+{
+    template <typename F>
+    void bench_one(const std::string& name, std::size_t operations, F f)
+    {
+        f();
+        const auto start = bench_clock::now();
+        f();
+        report(name, seconds_since(start) * 1e9 / operations, "ns/edit");
+    }
+
+    // Editor-like workload: the cursor jumps somewhere every 64 edits, and in between types
+    // three characters for every backspace.
+    template <typename Text>
+    void edit(Text& text, std::size_t edits)
+    {
+        unsigned state = 1;
+        std::size_t cursor = text.size() / 2;
+        for (std::size_t i = 0; i < edits; ++i)
+        {
+            if (i % 64 == 0)
+            {
+                state = state * 1103515245 + 12345;
+                cursor = (state >> 4) % (text.size() + 1);
+            }
+            if (i % 4 == 3 && cursor > 0)
+            {
+                text.erase(text.cbegin() + --cursor);
+            }
+            else
+            {
+                text.insert(text.cbegin() + cursor++, U'a' + static_cast<char32_t>(i % 26));
+            }
+        }
+    }
+}
+
+// Usage: bench_gap_vector [text length, default 1048576]
+// my_vector shifts the whole tail on every edit, so it only gets 1024 of them.
+int main(int argc, char** argv)
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t{ 1 } << 20;
+    const std::size_t edits = 1 << 16;
+    const std::size_t slowEdits = 1 << 10;
+
+    bench_one("cursor_edits/my_vector", slowEdits, [n, slowEdits]()
+    {
+        my_vector<char32_t> text(n, U'x');
+        edit(text, slowEdits);
+        do_not_optimize(text.data());
+    });
+
+    bench_one("cursor_edits/gap_vector", edits, [n, edits]()
+    {
+        const my_vector<char32_t> source(n, U'x');
+        gap_vector<char32_t> text(source.cbegin(), source.cend());
+        edit(text, edits);
+        do_not_optimize(text.flatten().data());
+    });
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+#include "my_vector.h"
+#include "gather_scatter.h"
+#include "bench_util.h"
+
+namespace
+{
+    constexpr std::size_t accessesCount = 1 << 23;
+
+    template <typename F>
+    void bench_one(const std::string& name, F f)
+    {
+        f();
+        const auto start = bench_clock::now();
+        f();
+        report(name, seconds_since(start) * 1e9 / accessesCount, "ns/element");
+    }
+
+    void bench_table(std::size_t tableBytes)
+    {
+        const std::size_t tableSize = tableBytes / sizeof(float);
+        my_vector<float> table(tableSize, 1.0f);
+
+        std::mt19937 gen(1);
+        std::uniform_int_distribution<std::uint32_t> dist(0, static_cast<std::uint32_t>(tableSize - 1));
+        my_vector<std::uint32_t> indices;
+        indices.reserve(accessesCount);
+        for (std::size_t i = 0; i < accessesCount; ++i)
+        {
+            indices.push_back(dist(gen));
+        }
+        my_vector<float> out(accessesCount, 0.0f);
+
+        const std::string prefix = "table=" + std::to_string(tableBytes >> 10) + "KiB/";
+        bench_one(prefix + "gather/loop", [&]()
+        {
+            for (std::size_t i = 0; i < accessesCount; ++i)
+            {
+                out[i] = table[indices[i]];
+            }
+            do_not_optimize(out.data());
+        });
+        for (std::size_t distance : { 0, 8, 16, 64 })
+        {
+            bench_one(prefix + "gather/scalar/prefetch=" + std::to_string(distance), [&]()
+            {
+                gather(table, indices, out, distance);
+                do_not_optimize(out.data());
+            });
+            bench_one(prefix + "gather/simd/prefetch=" + std::to_string(distance), [&]()
+            {
+                gather_simd(table, indices, out, distance);
+                do_not_optimize(out.data());
+            });
+        }
+        bench_one(prefix + "scatter", [&]()
+        {
+            scatter(table, indices, out);
+            do_not_optimize(table.data());
+        });
+        bench_one(prefix + "scatter_add", [&]()
+        {
+            scatter_add(table, indices, out);
+            do_not_optimize(table.data());
+        });
+    }
+}
+
+// Usage: bench_gather [largest table size in KiB, default 1048576]
+int main(int argc, char** argv)
+{
+    const std::size_t largestBytes = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 20) << 10;
+
+    for (std::size_t tableBytes = 16 << 10; tableBytes <= largestBytes; tableBytes <<= 4)
+    {
+        bench_table(tableBytes);
+    }
+
+    return 0;
+}
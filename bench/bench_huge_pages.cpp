@@ -0,0 +1,52 @@
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+#include "my_vector.h"
+#include "huge_page_storage.h"
+#include "bench_util.h"
+
+namespace
+{
+    constexpr std::size_t gathersCount = 1 << 24;
+
+    template <typename Table>
+    void bench_gather(const std::string& name, std::size_t tableBytes, const my_vector<std::uint32_t>& indices)
+    {
+        Table table;
+        table.resize(tableBytes / sizeof(float), 1.0f);
+
+        const auto start = bench_clock::now();
+        float sum = 0.0f;
+        for (std::size_t i = 0; i < indices.size(); ++i)
+        {
+            sum += table[indices[i]];
+        }
+        do_not_optimize(sum);
+
+        report(name + "/gather", seconds_since(start) * 1e9 / indices.size(), "ns/access");
+        report(name + "/anon_huge_pages", static_cast<double>(anon_huge_pages_bytes() >> 20), "MiB");
+    }
+}
+
+// Usage: bench_huge_pages [table size in MiB, default 1024]
+int main(int argc, char** argv)
+{
+    const std::size_t tableBytes = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1024) << 20;
+
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<std::uint32_t> dist(0, static_cast<std::uint32_t>(tableBytes / sizeof(float) - 1));
+    my_vector<std::uint32_t> indices;
+    indices.reserve(gathersCount);
+    for (std::size_t i = 0; i < gathersCount; ++i)
+    {
+        indices.push_back(dist(gen));
+    }
+
+    const std::string suffix = "/table=" + std::to_string(tableBytes >> 20) + "MiB";
+    bench_gather<my_vector<float>>("malloc_storage" + suffix, tableBytes, indices);
+    bench_gather<my_vector<float, alignof(float), huge_page_storage<>>>("huge_page_storage" + suffix, tableBytes, indices);
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <utility>
+
+#include "jagged_vector.h"
+#include "my_vector.h"
+#include "bench_util.h"
+
+namespace
+{
+    std::uint32_t next_random(std::uint64_t& state)
+    {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<std::uint32_t>(state >> 33);
+    }
+
+    // Breadth-first search from vertex 0, returning the sum of the distances it reached.
+    template <typename Graph>
+    std::uint64_t bfs(const Graph& graph, std::size_t vertices)
+    {
+        my_vector<std::uint32_t> distance(vertices, UINT32_MAX);
+        my_vector<std::uint32_t> frontier;
+        frontier.reserve(vertices);
+        frontier.push_back(0);
+        distance[0] = 0;
+        std::uint64_t sum = 0;
+        for (std::size_t head = 0; head < frontier.size(); ++head)
+        {
+            const std::uint32_t v = frontier[head];
+            for (const std::uint32_t neighbour : graph[v])
+            {
+                if (distance[neighbour] == UINT32_MAX)
+                {
+                    distance[neighbour] = distance[v] + 1;
+                    sum += distance[neighbour];
+                    frontier.push_back(neighbour);
+                }
+            }
+        }
+        return sum;
+    }
+
+    template <typename Graph>
+    void bench_bfs(const std::string& name, const Graph& graph, std::size_t vertices, std::size_t edges)
+    {
+        do_not_optimize(bfs(graph, vertices));
+        const auto start = bench_clock::now();
+        do_not_optimize(bfs(graph, vertices));
+        report(name, seconds_since(start) * 1e9 / edges, "ns/edge");
+    }
+}
+
+// Usage: bench_jagged_vector [vertices, default 1048576]
+// A random graph with 8 out-edges per vertex on average, stored as my_vector<my_vector<>> and
+// as jagged_vector, built from an edge list and then searched breadth first.
+int main(int argc, char** argv)
+{
+    const std::size_t vertices = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t{ 1 } << 20;
+    const std::size_t edges = vertices * 8;
+
+    my_vector<std::pair<std::uint32_t, std::uint32_t>> edgeList;
+    edgeList.reserve(edges);
+    std::uint64_t state = 7;
+    for (std::size_t i = 0; i < edges; ++i)
+    {
+        const std::uint32_t from = next_random(state) % vertices;
+        edgeList.push_back({ from, static_cast<std::uint32_t>(next_random(state) % vertices) });
+    }
+
+    auto start = bench_clock::now();
+    my_vector<my_vector<std::uint32_t>> nested;
+    nested.resize(vertices);
+    for (const auto& [from, to] : edgeList)
+    {
+        nested[from].push_back(to);
+    }
+    report("build/nested_my_vector", seconds_since(start) * 1e9 / edges, "ns/edge");
+
+    start = bench_clock::now();
+    const jagged_vector<std::uint32_t, std::uint32_t> jagged(from_row_value_pairs, vertices, edgeList.cbegin(), edgeList.cend());
+    report("build/jagged_vector", seconds_since(start) * 1e9 / edges, "ns/edge");
+
+    bench_bfs("bfs/nested_my_vector", nested, vertices, edges);
+    bench_bfs("bfs/jagged_vector", jagged, vertices, edges);
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <string>
+#include <algorithm>
+
+#include "mpmc_queue.h"
+#include "my_vector.h"
+#include "bench_util.h"
+
+namespace
+{
+    constexpr std::size_t queueCapacity = 1024;
+    constexpr std::uint64_t totalItems = 1 << 22;
+
+    // Baseline: the same bounded FIFO as a ring over a my_vector behind one mutex.
+    template <typename T>
+    class locked_queue
+    {
+    public:
+        explicit locked_queue(std::size_t capacity) :
+            m_buffer(capacity, T{})
+        {
+        }
+
+        bool try_push(const T& elem)
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_count == m_buffer.size())
+            {
+                return false;
+            }
+            m_buffer[(m_head + m_count++) % m_buffer.size()] = elem;
+            return true;
+        }
+
+        bool try_pop(T& out)
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_count == 0)
+            {
+                return false;
+            }
+            out = m_buffer[m_head];
+            m_head = (m_head + 1) % m_buffer.size();
+            --m_count;
+            return true;
+        }
+
+    private:
+        std::mutex m_mutex;
+        my_vector<T> m_buffer;
+        std::size_t m_head = 0;
+        std::size_t m_count = 0;
+    };
+
+    template <typename Queue>
+    double run(Queue& queue, unsigned threadsCount)
+    {
+        const std::uint64_t perProducer = totalItems / threadsCount;
+        std::atomic<std::uint64_t> popped{ 0 };
+        std::atomic<bool> go{ false };
+
+        my_vector<std::thread> threads;
+        for (unsigned t = 0; t < threadsCount; ++t)
+        {
+            threads.emplace_back([&]()
+            {
+                while (!go.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+                for (std::uint64_t i = 0; i < perProducer; ++i)
+                {
+                    while (!queue.try_push(i))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+            threads.emplace_back([&]()
+            {
+                while (!go.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+                std::uint64_t value = 0;
+                while (popped.load(std::memory_order_relaxed) < perProducer * threadsCount)
+                {
+                    if (queue.try_pop(value))
+                    {
+                        popped.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        const auto start = bench_clock::now();
+        go.store(true, std::memory_order_release);
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        return perProducer * threadsCount / seconds_since(start) / 1e6;
+    }
+}
+
+int main()
+{
+    const unsigned maxThreads = std::max(4u, std::thread::hardware_concurrency());
+    for (unsigned threadsCount = 1; threadsCount <= maxThreads; threadsCount <<= 1)
+    {
+        const std::string suffix = "/threads=" + std::to_string(threadsCount) + "/throughput";
+
+        mpmc_queue<std::uint64_t> queue(queueCapacity);
+        report("mpmc_queue" + suffix, run(queue, threadsCount), "Mitems/s");
+
+        locked_queue<std::uint64_t> lockedQueue(queueCapacity);
+        report("locked_my_vector" + suffix, run(lockedQueue, threadsCount), "Mitems/s");
+    }
+
+    return 0;
+}
@@ -0,0 +1,52 @@
+#include <cstdlib>
+#include <optional>
+#include <string>
+
+#include "my_vector.h"
+#include "prefault.h"
+#include "bench_util.h"
+
+namespace
+{
+    // Time in reserve() and in the first pass writing every element, which is where the page
+    // faults land without a prefault. A background prefault races with that pass.
+    void bench_first_fill(const std::string& name, std::size_t bytes, std::optional<prefault_policy> policy)
+    {
+        my_vector<char> buffer;
+        const auto start = bench_clock::now();
+        prefault_handle handle;
+        if (policy)
+        {
+            handle = reserve(buffer, bytes, *policy);
+        }
+        else
+        {
+            buffer.reserve(bytes);
+        }
+        const double reserveSeconds = seconds_since(start);
+
+        const auto fillStart = bench_clock::now();
+        buffer.resize(bytes, 'x');
+        do_not_optimize(buffer.data());
+        const double fillSeconds = seconds_since(fillStart);
+        handle.wait();
+
+        report(name + "/reserve", reserveSeconds * 1e3, "ms");
+        report(name + "/first_fill", fillSeconds * 1e3, "ms");
+        report(name + "/total", seconds_since(start) * 1e3, "ms");
+    }
+}
+
+// Usage: bench_prefault [buffer size in MiB, default 1024]
+// parallel_touch and background only pay off with more than one core to run on.
+int main(int argc, char** argv)
+{
+    const std::size_t bytes = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1024) << 20;
+
+    bench_first_fill("prefault/none", bytes, std::nullopt);
+    bench_first_fill("prefault/populate", bytes, prefault_policy::populate);
+    bench_first_fill("prefault/parallel_touch", bytes, prefault_policy::parallel_touch);
+    bench_first_fill("prefault/background", bytes, prefault_policy::background);
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include <cstdlib>
+#include <algorithm>
+#include <string>
+
+#include "my_vector.h"
+#include "ring_vector.h"
+#include "bench_util.h"
+
+namespace
+{
+    template <typename F>
+    void bench_one(const std::string& name, std::size_t operations, F f)
+    {
+        f();
+        const auto start = bench_clock::now();
+        f();
+        report(name, seconds_since(start) * 1e9 / operations, "ns/event");
+    }
+
+    double window_sum(const ring_vector<double>& window)
+    {
+        double sum = 0.0;
+        const auto [first, second] = window.as_spans();
+        for (const double sample : first)
+        {
+            sum += sample;
+        }
+        for (const double sample : second)
+        {
+            sum += sample;
+        }
+        return sum;
+    }
+}
+
+// Usage: bench_ring_vector [window samples, default 1048576]
+// Every event appends one sample and evicts the oldest. my_vector's erase(begin()) is O(window),
+// so it only gets a 16384-sample window.
+int main(int argc, char** argv)
+{
+    const std::size_t window = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t{ 1 } << 20;
+    const std::size_t smallWindow = std::min<std::size_t>(window, 1 << 14);
+    const std::size_t events = 1 << 22;
+    const std::size_t slowEvents = 1 << 14;
+
+    bench_one("window/my_vector_erase_begin", slowEvents, [smallWindow, slowEvents]()
+    {
+        my_vector<double> samples(smallWindow, 1.0);
+        for (std::size_t i = 0; i < slowEvents; ++i)
+        {
+            samples.push_back(static_cast<double>(i));
+            samples.erase(samples.cbegin());
+        }
+        do_not_optimize(samples.data());
+    });
+
+    bench_one("window/ring_vector", events, [window, events]()
+    {
+        ring_vector<double> samples;
+        for (std::size_t i = 0; i < window; ++i)
+        {
+            samples.push_back(1.0);
+        }
+        for (std::size_t i = 0; i < events; ++i)
+        {
+            samples.push_back(static_cast<double>(i));
+            samples.pop_front();
+        }
+        do_not_optimize(samples.front());
+    });
+
+    bench_one("window/ring_vector_overwrite", events, [window, events]()
+    {
+        ring_vector<double> samples(overwrite_oldest, window);
+        for (std::size_t i = 0; i < window + events; ++i)
+        {
+            samples.push_back(static_cast<double>(i));
+        }
+        do_not_optimize(samples.front());
+    });
+
+    ring_vector<double> full(overwrite_oldest, window);
+    for (std::size_t i = 0; i < window + window / 3; ++i)
+    {
+        full.push_back(1.0);
+    }
+    const auto start = bench_clock::now();
+    double sum = 0.0;
+    for (int i = 0; i < 16; ++i)
+    {
+        sum += window_sum(full);
+    }
+    do_not_optimize(sum);
+    report("sum_as_spans/ring_vector", seconds_since(start) * 1e9 / (16.0 * static_cast<double>(window)), "ns/sample");
+
+    return 0;
+}
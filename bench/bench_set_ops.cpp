@@ -0,0 +1,79 @@
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <random>
+#include <unordered_set>
+
+#include "my_vector.h"
+#include "set_ops.h"
+#include "bench_util.h"
+
+namespace
+{
+    my_vector<std::uint32_t> make_values(std::size_t n, std::uint32_t distinct, std::uint64_t seed)
+    {
+        std::mt19937 gen(static_cast<std::uint32_t>(seed));
+        std::uniform_int_distribution<std::uint32_t> dist(0, distinct - 1);
+        my_vector<std::uint32_t> values;
+        values.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            values.push_back(dist(gen));
+        }
+
+        return values;
+    }
+
+    template <typename F>
+    void bench_one(const char* name, std::size_t n, F f)
+    {
+        const auto start = bench_clock::now();
+        do_not_optimize(f());
+        report(name, seconds_since(start) * 1e9 / n, "ns/element");
+    }
+}
+
+// Usage: bench_set_ops [elements, default 4194304]
+int main(int argc, char** argv)
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t{ 1 } << 22;
+    const auto distinct = static_cast<std::uint32_t>(n / 2);
+    const my_vector<std::uint32_t> lhs = make_values(n, distinct, 1);
+    const my_vector<std::uint32_t> rhs = make_values(n, distinct, 2);
+
+    bench_one("dedupe/sort+unique", n, [&]()
+    {
+        my_vector<std::uint32_t> sorted = lhs;
+        std::sort(sorted.begin(), sorted.end());
+        return std::unique(sorted.begin(), sorted.end()) - sorted.begin();
+    });
+    bench_one("dedupe/std::unordered_set", n, [&]()
+    {
+        std::unordered_set<std::uint32_t> seen(lhs.begin(), lhs.end());
+        return seen.size();
+    });
+    bench_one("dedupe/open_hash_set", n, [&]() { return dedupe(lhs).size(); });
+
+    bench_one("intersect/sort+set_intersection", 2 * n, [&]()
+    {
+        my_vector<std::uint32_t> lhsSorted = lhs;
+        my_vector<std::uint32_t> rhsSorted = rhs;
+        std::sort(lhsSorted.begin(), lhsSorted.end());
+        std::sort(rhsSorted.begin(), rhsSorted.end());
+        const auto lhsEnd = std::unique(lhsSorted.begin(), lhsSorted.end());
+        const auto rhsEnd = std::unique(rhsSorted.begin(), rhsSorted.end());
+        my_vector<std::uint32_t> result;
+        result.reserve(n);
+        result.resize(n);
+        return std::set_intersection(lhsSorted.begin(), lhsEnd, rhsSorted.begin(), rhsEnd, result.data()) - result.data();
+    });
+    bench_one("intersect/open_hash_set", 2 * n, [&]() { return intersect(lhs, rhs).size(); });
+    bench_one("difference/open_hash_set", 2 * n, [&]() { return difference(lhs, rhs).size(); });
+
+    bench_one("count_distinct/open_hash_set", n, [&]() { return count_distinct(lhs); });
+    bench_one("count_distinct/hyperloglog", n, [&]() { return count_distinct_approx(lhs); });
+    report("count_distinct/exact", static_cast<double>(count_distinct(lhs)), "distinct");
+    report("count_distinct/hyperloglog_estimate", count_distinct_approx(lhs), "distinct");
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <type_traits>
+
+#include "my_vector.h"
+#include "my_sort.h"
+#include "bench_util.h"
+
+namespace
+{
+    template <typename K>
+    my_vector<K> make_keys(std::size_t n)
+    {
+        std::mt19937_64 gen(1);
+        my_vector<K> keys;
+        keys.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if constexpr (std::is_floating_point_v<K>)
+            {
+                keys.push_back(std::uniform_real_distribution<K>(-1e9, 1e9)(gen));
+            }
+            else
+            {
+                keys.push_back(static_cast<K>(gen()));
+            }
+        }
+
+        return keys;
+    }
+
+    template <typename K, typename Sort>
+    void bench_one(const std::string& name, const my_vector<K>& input, Sort sort)
+    {
+        my_vector<K> keys = input;
+        const auto start = bench_clock::now();
+        sort(keys);
+        const double elapsed = seconds_since(start);
+        do_not_optimize(keys.data());
+
+        report(name, elapsed * 1e9 / input.size(), "ns/key");
+    }
+
+    template <typename K>
+    void bench_keys(const std::string& type, std::size_t n)
+    {
+        const my_vector<K> input = make_keys<K>(n);
+
+        bench_one(type + "/std::sort", input, [](my_vector<K>& keys) { std::sort(keys.begin(), keys.end()); });
+        bench_one(type + "/radix_sort", input, [](my_vector<K>& keys) { radix_sort(keys); });
+        bench_one(type + "/radix_sort_in_place", input, [](my_vector<K>& keys) { radix_sort_in_place(keys); });
+        bench_one(type + "/parallel_merge_sort", input, [](my_vector<K>& keys) { parallel_merge_sort(keys); });
+    }
+
+    void bench_key_value(std::size_t n)
+    {
+        const my_vector<std::uint32_t> inputKeys = make_keys<std::uint32_t>(n);
+
+        my_vector<std::pair<std::uint32_t, std::uint32_t>> pairs;
+        pairs.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            pairs.push_back({ inputKeys[i], static_cast<std::uint32_t>(i) });
+        }
+        auto start = bench_clock::now();
+        std::sort(pairs.begin(), pairs.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+        report("u32+u32/std::sort", seconds_since(start) * 1e9 / n, "ns/key");
+        do_not_optimize(pairs.data());
+
+        my_vector<std::uint32_t> keys = inputKeys;
+        my_vector<std::uint32_t> values;
+        values.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            values.push_back(static_cast<std::uint32_t>(i));
+        }
+        start = bench_clock::now();
+        radix_sort(keys, values);
+        report("u32+u32/radix_sort", seconds_since(start) * 1e9 / n, "ns/key");
+        do_not_optimize(values.data());
+    }
+}
+
+// Usage: bench_sort [keys, default 4194304]
+int main(int argc, char** argv)
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t{ 1 } << 22;
+
+    bench_keys<std::uint32_t>("u32", n);
+    bench_keys<std::uint64_t>("u64", n);
+    bench_keys<float>("f32", n);
+    bench_key_value(n);
+
+    return 0;
+}
@@ -0,0 +1,132 @@
+#include <cstdint>
+#include <algorithm>
+#include <thread>
+#include <string>
+
+#include "spsc_ring.h"
+#include "my_vector.h"
+#include "bench_util.h"
+
+namespace
+{
+    constexpr std::size_t ringSize = 4096;
+    constexpr std::uint64_t itemsCount = 1 << 24;
+    constexpr std::size_t latencySamples = 1 << 18;
+
+    void bench_throughput(std::size_t batchSize)
+    {
+        spsc_ring<std::uint64_t, ringSize> ring;
+        const auto start = bench_clock::now();
+
+        std::thread producer([&ring, batchSize]()
+        {
+            my_vector<std::uint64_t> batch(batchSize, 0);
+            std::uint64_t next = 0;
+            while (next < itemsCount)
+            {
+                const std::size_t count = std::min<std::uint64_t>(batchSize, itemsCount - next);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    batch[i] = next + i;
+                }
+                const std::size_t pushed = ring.push_n(batch.data(), count);
+                if (pushed == 0)
+                {
+                    std::this_thread::yield();
+                }
+                next += pushed;
+            }
+        });
+
+        my_vector<std::uint64_t> batch(batchSize, 0);
+        std::uint64_t received = 0;
+        std::uint64_t checksum = 0;
+        while (received < itemsCount)
+        {
+            const std::size_t count = ring.pop_n(batch.data(), batchSize);
+            if (count == 0)
+            {
+                std::this_thread::yield();
+            }
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                checksum += batch[i];
+            }
+            received += count;
+        }
+        producer.join();
+        do_not_optimize(checksum);
+
+        report("spsc_ring/batch=" + std::to_string(batchSize) + "/throughput", itemsCount / seconds_since(start) / 1e6, "Mitems/s");
+    }
+
+    // Every element carries its enqueue timestamp; the consumer records how long it waited in the ring.
+    void bench_latency(std::size_t batchSize)
+    {
+        spsc_ring<std::int64_t, ringSize> ring;
+
+        std::thread producer([&ring, batchSize]()
+        {
+            my_vector<std::int64_t> batch(batchSize, 0);
+            std::size_t sent = 0;
+            while (sent < latencySamples)
+            {
+                const std::size_t count = std::min(batchSize, latencySamples - sent);
+                const std::int64_t now = bench_clock::now().time_since_epoch().count();
+                std::fill_n(batch.data(), count, now);
+
+                std::size_t pushed = 0;
+                while (pushed < count)
+                {
+                    pushed += ring.push_n(batch.data() + pushed, count - pushed);
+                    if (pushed < count)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+                sent += count;
+
+                // Pace the producer so the ring stays mostly empty and we measure handoff, not queueing.
+                while (!ring.is_empty())
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        my_vector<std::int64_t> latencies;
+        latencies.reserve(latencySamples);
+        my_vector<std::int64_t> batch(batchSize, 0);
+        while (latencies.size() < latencySamples)
+        {
+            const std::size_t count = ring.pop_n(batch.data(), batchSize);
+            if (count == 0)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            const std::int64_t now = bench_clock::now().time_since_epoch().count();
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                latencies.push_back(now - batch[i]);
+            }
+        }
+        producer.join();
+
+        std::sort(latencies.begin(), latencies.end());
+        const std::string name = "spsc_ring/batch=" + std::to_string(batchSize);
+        report(name + "/latency_p50", static_cast<double>(latencies[latencies.size() / 2]), "ns");
+        report(name + "/latency_p99", static_cast<double>(latencies[latencies.size() * 99 / 100]), "ns");
+    }
+}
+
+int main()
+{
+    for (std::size_t batchSize : { 1, 8, 64, 256 })
+    {
+        bench_throughput(batchSize);
+        bench_latency(batchSize);
+    }
+
+    return 0;
+}
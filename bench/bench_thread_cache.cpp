@@ -0,0 +1,63 @@
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+#include "my_vector.h"
+#include "thread_cache_storage.h"
+#include "bench_util.h"
+
+namespace
+{
+    constexpr std::size_t roundsPerThread = 20000;
+
+    // Each round builds a few short-lived vectors of mixed capacity classes, like a worker
+    // that assembles and drops per-request buffers.
+    template <typename Storage>
+    void worker()
+    {
+        for (std::size_t round = 0; round < roundsPerThread; ++round)
+        {
+            my_vector<int, alignof(int), Storage> small;
+            my_vector<double, alignof(double), Storage> medium;
+            for (std::size_t i = 0; i < 16; ++i)
+            {
+                small.push_back(static_cast<int>(i));
+            }
+            medium.reserve(512 + round % 512);
+            medium.push_back(1.0);
+            do_not_optimize(small.data());
+            do_not_optimize(medium.data());
+        }
+    }
+
+    template <typename Storage>
+    void bench_storage(const std::string& name, std::size_t threadsCount)
+    {
+        const auto start = bench_clock::now();
+        my_vector<std::thread> threads;
+        for (std::size_t t = 0; t < threadsCount; ++t)
+        {
+            threads.emplace_back(worker<Storage>);
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        report(name + "/threads=" + std::to_string(threadsCount), seconds_since(start) * 1e9 / (roundsPerThread * threadsCount), "ns/round");
+    }
+}
+
+// Usage: bench_thread_cache [max threads, default 64]
+int main(int argc, char** argv)
+{
+    const std::size_t maxThreads = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 64;
+
+    for (std::size_t threadsCount = 1; threadsCount <= maxThreads; threadsCount *= 4)
+    {
+        bench_storage<malloc_storage>("malloc_storage", threadsCount);
+        bench_storage<thread_cache_storage>("thread_cache_storage", threadsCount);
+    }
+
+    return 0;
+}
@@ -0,0 +1,28 @@
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+using bench_clock = std::chrono::steady_clock;
+
+inline double seconds_since(bench_clock::time_point start)
+{
+    return std::chrono::duration<double>(bench_clock::now() - start).count();
+}
+
+// One result per line as "<name> <value> <unit>", so runs can be diffed and compared by scripts.
+inline void report(const std::string& name, double value, const char* unit)
+{
+    std::printf("%-48s %14.3f %s\n", name.c_str(), value, unit);
+    std::fflush(stdout);
+}
+
+template <typename T>
+inline void do_not_optimize(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+#endif
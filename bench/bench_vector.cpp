@@ -0,0 +1,81 @@
+#include <cstdlib>
+#include <string>
+
+#include "my_vector.h"
+#include "bench_util.h"
+
+namespace
+{
+    template <typename F>
+    void bench_one(const std::string& name, std::size_t operations, F f)
+    {
+        f();
+        const auto start = bench_clock::now();
+        f();
+        report(name, seconds_since(start) * 1e9 / operations, "ns/op");
+    }
+}
+
+// Usage: bench_vector [elements, default 1048576]
+int main(int argc, char** argv)
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t{ 1 } << 20;
+
+    bench_one("push_back/int", n, [n]()
+    {
+        my_vector<int> vec;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            vec.push_back(static_cast<int>(i));
+        }
+        do_not_optimize(vec.data());
+    });
+
+    bench_one("push_back/string", n, [n]()
+    {
+        my_vector<std::string> vec;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            vec.push_back(std::string(24, 'x'));
+        }
+        do_not_optimize(vec.data());
+    });
+
+    bench_one("resize/int", n, [n]()
+    {
+        my_vector<int> vec;
+        vec.resize(n);
+        do_not_optimize(vec.data());
+    });
+
+    my_vector<int> source(n, 1);
+    bench_one("copy/int", n, [&source]()
+    {
+        my_vector<int> copy = source;
+        do_not_optimize(copy.data());
+    });
+
+    const std::size_t middleOps = 1000;
+    bench_one("insert_erase_middle/int", middleOps, [&source, middleOps]()
+    {
+        my_vector<int> vec = source;
+        for (std::size_t i = 0; i < middleOps; ++i)
+        {
+            vec.insert(vec.cbegin() + vec.size() / 2, static_cast<int>(i));
+            vec.erase(vec.cbegin() + vec.size() / 3);
+        }
+        do_not_optimize(vec.data());
+    });
+
+    bench_one("erase_range/string", n, [n]()
+    {
+        my_vector<std::string> vec(n, std::string(24, 'x'));
+        while (vec.size() > 64)
+        {
+            vec.erase(vec.begin(), vec.begin() + vec.size() / 2);
+        }
+        do_not_optimize(vec.data());
+    });
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+#include "my_vector.h"
+#include "bench_util.h"
+
+namespace
+{
+    // Vertex ids of a sparse random graph, most vertices having a handful of edges and some none.
+    std::uint32_t next_random(std::uint64_t& state)
+    {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<std::uint32_t>(state >> 33);
+    }
+
+    template <typename Adjacency>
+    void bench_layout(const std::string& layout, std::size_t vertices, std::size_t headerBytes)
+    {
+        const auto start = bench_clock::now();
+        my_vector<Adjacency> graph;
+        graph.resize(vertices);
+        std::uint64_t state = 42;
+        std::size_t edges = 0;
+        for (std::size_t v = 0; v < vertices; ++v)
+        {
+            const std::uint32_t degree = next_random(state) % 8;
+            for (std::uint32_t e = 0; e < degree; ++e)
+            {
+                graph[v].push_back(next_random(state) % vertices);
+            }
+            edges += degree;
+        }
+        report("build/" + layout, seconds_since(start) * 1e9 / edges, "ns/edge");
+
+        // Two hops from every vertex, the access pattern of a BFS frontier expansion.
+        const auto traverseStart = bench_clock::now();
+        std::uint64_t sum = 0;
+        for (std::size_t v = 0; v < vertices; ++v)
+        {
+            for (const std::uint32_t neighbour : graph[v])
+            {
+                sum += graph[neighbour].size();
+            }
+        }
+        do_not_optimize(sum);
+        report("traverse/" + layout, seconds_since(traverseStart) * 1e9 / edges, "ns/edge");
+
+        std::size_t bytes = vertices * sizeof(Adjacency);
+        for (std::size_t v = 0; v < vertices; ++v)
+        {
+            bytes += graph[v].capacity() * sizeof(std::uint32_t) + (graph[v].capacity() != 0 ? headerBytes : 0);
+        }
+        report("memory/" + layout, static_cast<double>(bytes) / vertices, "bytes/vertex");
+    }
+}
+
+// Usage: bench_vector_layout [vertices, default 1048576]
+// Heap bytes count what the layout asks for, not malloc's own per-block overhead.
+int main(int argc, char** argv)
+{
+    const std::size_t vertices = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t{ 1 } << 20;
+
+    bench_layout<my_vector<std::uint32_t>>("wide_layout", vertices, 0);
+    bench_layout<compact_vector<std::uint32_t>>("compact_layout", vertices, 0);
+    bench_layout<thin_vector<std::uint32_t>>("thin_layout", vertices, 2 * sizeof(std::uint32_t));
+
+    return 0;
+}
@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""Runs benchmarks and compares their report() lines against a stored baseline.
+
+Every benchmark prints "<name> <value> <unit>" per result (see bench_util.h). Results in
+time-per-item units (ns/...) must not grow, and rates (.../s) must not drop, by more than
+--threshold percent relative to the baseline. Other units are informational and not checked.
+Each benchmark runs --repeat times and the best value counts, which filters out most noise.
+
+Usage:
+    check_regression.py --baseline bench/baseline.txt --bench "build/bench_sort 1048576" ...
+    check_regression.py --baseline bench/baseline.txt --update --bench ...
+"""
+
+import argparse
+import shlex
+import subprocess
+import sys
+
+
+def lower_is_better(unit):
+    if unit.startswith("ns"):
+        return True
+    if unit.endswith("/s"):
+        return False
+    return None
+
+
+def run_benchmarks(commands, repeat):
+    best = {}
+    for command in commands:
+        for _ in range(repeat):
+            output = subprocess.run(shlex.split(command), check=True, capture_output=True, text=True).stdout
+            for line in output.splitlines():
+                parts = line.rsplit(None, 2)
+                if len(parts) != 3:
+                    continue
+                name, value, unit = parts[0].strip(), float(parts[1]), parts[2]
+                direction = lower_is_better(unit)
+                if direction is None:
+                    continue
+                if name not in best:
+                    best[name] = (value, unit)
+                elif (value < best[name][0]) == direction:
+                    best[name] = (value, unit)
+    return best
+
+
+def read_baseline(path):
+    baseline = {}
+    with open(path) as file:
+        for line in file:
+            parts = line.rsplit(None, 2)
+            if len(parts) == 3 and not line.startswith("#"):
+                baseline[parts[0].strip()] = (float(parts[1]), parts[2])
+    return baseline
+
+
+def write_baseline(path, results):
+    with open(path, "w") as file:
+        file.write("# Written by check_regression.py --update; best of the repeated runs.\n")
+        for name, (value, unit) in sorted(results.items()):
+            file.write(f"{name:<56} {value:14.3f} {unit}\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--baseline", required=True)
+    parser.add_argument("--bench", action="append", required=True, help="benchmark command line, repeatable")
+    parser.add_argument("--threshold", type=float, default=10.0, help="allowed slowdown in percent")
+    parser.add_argument("--repeat", type=int, default=3)
+    parser.add_argument("--update", action="store_true", help="overwrite the baseline with this run")
+    args = parser.parse_args()
+
+    results = run_benchmarks(args.bench, args.repeat)
+    if args.update:
+        write_baseline(args.baseline, results)
+        print(f"wrote {len(results)} results to {args.baseline}")
+        return 0
+
+    baseline = read_baseline(args.baseline)
+    regressions = 0
+    for name, (value, unit) in sorted(results.items()):
+        if name not in baseline:
+            print(f"{'new':>10} {name} {value:.3f} {unit}")
+            continue
+        base = baseline[name][0]
+        change = (value - base) / base * 100.0 if base != 0 else 0.0
+        slowdown = change if lower_is_better(unit) else -change
+        status = "REGRESSED" if slowdown > args.threshold else "ok"
+        regressions += status != "ok"
+        print(f"{status:>10} {name} {base:.3f} -> {value:.3f} {unit} ({change:+.1f}%)")
+    for name in sorted(set(baseline) - set(results)):
+        print(f"{'missing':>10} {name}")
+
+    if regressions:
+        print(f"{regressions} benchmark(s) slowed by more than {args.threshold}%")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
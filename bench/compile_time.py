@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""Measures how long translation units that use my_vector take to compile.
+
+Generates --units source files that each use my_vector<int>, my_vector<double> and
+my_vector<std::string> the way ordinary code does, then compiles all of them once per variant:
+
+    header_only        plain #include, every unit instantiates everything itself
+    extern_templates   -DMY_CONTAINERS_EXTERN_TEMPLATES, as when linking the my_containers target
+    pch                the headers precompiled once and force-included
+    extern_pch         both of the above
+
+Results are printed as "<name> <value> <unit>" lines like the benchmarks. One-time costs
+(building the PCH, compiling src/my_containers.cpp) are reported separately.
+
+Usage:
+    compile_time.py [--compiler g++] [--units 20] [--flags="-O2 -g"]
+"""
+
+import argparse
+import os
+import pathlib
+import shlex
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+
+UNIT_TEMPLATE = """#include <string>
+
+#include "my_vector.h"
+
+int unit_{index}(int seed)
+{{
+    my_vector<int> ints;
+    for (int i = 0; i < seed; ++i)
+    {{
+        ints.push_back(i * {index});
+    }}
+    ints.insert(ints.cbegin(), seed + 1);
+    ints.erase(ints.begin() + 1, ints.end());
+    ints.resize(16);
+    ints.shrink_to_fit();
+
+    my_vector<double> doubles{{ 1.0, 2.0 }};
+    doubles.reserve(64);
+    doubles.emplace_back(seed);
+    doubles = {{ 3.0 }};
+
+    my_vector<std::string> strings(3, std::string("x"));
+    strings.push_back(std::to_string(seed));
+    strings.insert(strings.cbegin() + 1, strings.cbegin(), strings.cend());
+    my_vector<std::string> copy = strings;
+    copy.erase(copy.cbegin());
+    copy.pop_back();
+
+    return static_cast<int>(ints.size() + doubles.size() + copy.size()) + (strings == copy ? 1 : 0);
+}}
+"""
+
+PCH_HEADER = """#include <string>
+
+#include "my_vector.h"
+"""
+
+
+def report(name, value, unit):
+    print(f"{name:<48} {value:14.3f} {unit}", flush=True)
+
+
+def is_clang(compiler):
+    version = subprocess.run([compiler, "--version"], capture_output=True, text=True).stdout
+    return "clang" in version
+
+
+def compile_one(command):
+    start = time.perf_counter()
+    subprocess.run(command, check=True)
+    return time.perf_counter() - start
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "c++"))
+    parser.add_argument("--units", type=int, default=20)
+    parser.add_argument("--flags", default="-O0", help="extra compiler flags, e.g. \"-O2 -g\"")
+    args = parser.parse_args()
+
+    flags = ["-std=c++20", *shlex.split(args.flags), f"-I{ROOT / 'include'}"]
+    clang = is_clang(args.compiler)
+
+    with tempfile.TemporaryDirectory() as work:
+        work = pathlib.Path(work)
+        units = []
+        for index in range(args.units):
+            unit = work / f"unit_{index}.cpp"
+            unit.write_text(UNIT_TEMPLATE.format(index=index))
+            units.append(unit)
+
+        pch_flags = {}
+        for variant, defines in (("pch", []), ("extern_pch", ["-DMY_CONTAINERS_EXTERN_TEMPLATES"])):
+            header = work / f"{variant}.h"
+            header.write_text(PCH_HEADER)
+            if clang:
+                output = work / f"{variant}.h.pch"
+                use = ["-include-pch", str(output)]
+            else:
+                output = work / f"{variant}.h.gch"
+                use = ["-include", str(header)]
+            seconds = compile_one([args.compiler, *flags, *defines, "-x", "c++-header", str(header), "-o", str(output)])
+            report(f"compile/{variant}_build_once", seconds * 1e3, "ms")
+            pch_flags[variant] = [*defines, *use]
+
+        seconds = compile_one([args.compiler, *flags, "-DMY_CONTAINERS_EXTERN_TEMPLATES",
+                               "-c", str(ROOT / "src" / "my_containers.cpp"), "-o", str(work / "my_containers.o")])
+        report("compile/my_containers_library_once", seconds * 1e3, "ms")
+
+        variants = (
+            ("header_only", []),
+            ("extern_templates", ["-DMY_CONTAINERS_EXTERN_TEMPLATES"]),
+            ("pch", pch_flags["pch"]),
+            ("extern_pch", pch_flags["extern_pch"]),
+        )
+        for name, extra in variants:
+            total = 0.0
+            for unit in units:
+                total += compile_one([args.compiler, *flags, *extra, "-c", str(unit), "-o", str(unit.with_suffix(".o"))])
+            report(f"compile/{name}", total / len(units) * 1e3, "ms/unit")
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""Checks that my_vector's hardening costs nothing when it is off.
+
+Compiles codegen_pairs.cpp to assembly and compares every checked_<name> function with its
+raw_<name> counterpart after dropping assembler directives, renumbering local labels and
+ordering the operands of comparisons that only feed an equality jump, which the compiler
+emits either way round depending on how the source spelled the comparison. Any
+difference is printed and fails the check. With --hardened the file is compiled with
+MY_VECTOR_HARDENED instead and the pairs are expected to differ, which shows that the
+comparison actually sees the checks.
+
+Usage:
+    check_codegen.py [--compiler g++] [--flags="-O2"] [--hardened]
+"""
+
+import argparse
+import os
+import pathlib
+import re
+import shlex
+import subprocess
+import sys
+import tempfile
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+
+LABEL = re.compile(r"\.L[A-Za-z_]*\d+")
+EQUALITY_COMPARE = re.compile(r"(cmp[a-z]*)\s+(.+)")
+EQUALITY_JUMPS = ("je", "jne", "jz", "jnz")
+
+
+def compile_to_assembly(compiler, flags):
+    with tempfile.TemporaryDirectory() as work:
+        output = pathlib.Path(work) / "codegen_pairs.s"
+        subprocess.run([compiler, "-std=c++20", *flags, f"-I{ROOT / 'include'}", "-S",
+                        "-fno-asynchronous-unwind-tables", "-fno-exceptions",
+                        str(ROOT / "codegen" / "codegen_pairs.cpp"), "-o", str(output)], check=True)
+        return output.read_text()
+
+
+def function_bodies(assembly):
+    bodies = {}
+    name = None
+    for line in assembly.splitlines():
+        stripped = line.split("#")[0].strip()
+        if not stripped:
+            continue
+        if not line[0].isspace() and stripped.endswith(":") and not stripped.startswith("."):
+            name = stripped[:-1]
+            bodies[name] = []
+        elif name is not None and stripped.startswith(".size") and stripped.split()[1].rstrip(",") == name:
+            name = None
+        elif name is not None and not (stripped.startswith(".") and not stripped.startswith(".L")):
+            bodies[name].append(stripped)
+    return {name: normalize(body) for name, body in bodies.items()}
+
+
+def normalize(body):
+    labels = {}
+    for line in body:
+        for label in LABEL.findall(line):
+            labels.setdefault(label, f".L{len(labels)}")
+    body = [LABEL.sub(lambda match: labels[match.group(0)], line) for line in body]
+    for index, line in enumerate(body[:-1]):
+        compare = EQUALITY_COMPARE.fullmatch(line)
+        if compare and body[index + 1].split()[0] in EQUALITY_JUMPS:
+            operands = sorted(operand.strip() for operand in split_operands(compare.group(2)))
+            body[index] = f"{compare.group(1)}\t{', '.join(operands)}"
+    return body
+
+
+def split_operands(operands):
+    depth = 0
+    start = 0
+    for index, char in enumerate(operands):
+        depth += char == "("
+        depth -= char == ")"
+        if char == "," and depth == 0:
+            yield operands[start:index]
+            start = index + 1
+    yield operands[start:]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "c++"))
+    parser.add_argument("--flags", default="-O2", help="optimization flags, e.g. \"-O3 -march=native\"")
+    parser.add_argument("--hardened", action="store_true", help="expect every pair to differ")
+    args = parser.parse_args()
+
+    flags = shlex.split(args.flags)
+    if args.hardened:
+        flags.append("-DMY_VECTOR_HARDENED")
+    bodies = function_bodies(compile_to_assembly(args.compiler, flags))
+
+    # Hardened builds split the failure paths into checked_<name>.cold fragments; skip those.
+    pairs = sorted(name[len("checked_"):] for name in bodies if name.startswith("checked_") and "." not in name)
+    if not pairs:
+        print("no checked_ functions found", file=sys.stderr)
+        return 1
+
+    failed = False
+    for pair in pairs:
+        checked = bodies[f"checked_{pair}"]
+        raw = bodies.get(f"raw_{pair}")
+        if raw is None:
+            print(f"{pair}: raw_{pair} is missing")
+            failed = True
+        elif (checked == raw) == args.hardened:
+            failed = True
+            print(f"{pair}: {'identical' if args.hardened else 'differs'}")
+            if not args.hardened:
+                width = max(map(len, checked), default=0)
+                for index in range(max(len(checked), len(raw))):
+                    left = checked[index] if index < len(checked) else ""
+                    right = raw[index] if index < len(raw) else ""
+                    print(f"  {'  ' if left == right else '! '}{left:<{width}}   {right}")
+        else:
+            print(f"{pair}: {'differs' if args.hardened else 'identical'} ({len(checked)} instructions)")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,92 @@
+// Pairs of functions that must compile to the same instructions when MY_VECTOR_HARDENED is
+// off: each checked_<name> goes through my_vector, each raw_<name> does the same through a
+// struct with my_vector's layout. check_codegen.py compiles this file and compares the pairs.
+
+#include <algorithm>
+#include <cstddef>
+
+#include "my_vector.h"
+
+struct raw_vector
+{
+    std::size_t capacity;
+    std::size_t size;
+    int* data;
+};
+
+#ifndef MY_VECTOR_HARDENED
+static_assert(sizeof(raw_vector) == sizeof(my_vector<int>));
+#endif
+
+extern "C"
+{
+    int checked_index(my_vector<int>& vec, std::size_t i)
+    {
+        return vec[i];
+    }
+
+    int raw_index(raw_vector& vec, std::size_t i)
+    {
+        return vec.data[i];
+    }
+
+    int checked_front_back(const my_vector<int>& vec)
+    {
+        return vec.front() + vec.back();
+    }
+
+    int raw_front_back(const raw_vector& vec)
+    {
+        return vec.data[0] + vec.data[vec.size - 1];
+    }
+
+    long checked_iterate(const my_vector<int>& vec)
+    {
+        long sum = 0;
+        for (const int value : vec)
+        {
+            sum += value;
+        }
+        return sum;
+    }
+
+    long raw_iterate(const raw_vector& vec)
+    {
+        long sum = 0;
+        for (const int* it = vec.data; it != vec.data + vec.size; ++it)
+        {
+            sum += *it;
+        }
+        return sum;
+    }
+
+    long checked_reverse_iterate(const my_vector<int>& vec)
+    {
+        long sum = 0;
+        for (auto it = vec.crbegin(); it != vec.crend(); ++it)
+        {
+            sum = sum * 3 + *it;
+        }
+        return sum;
+    }
+
+    long raw_reverse_iterate(const raw_vector& vec)
+    {
+        long sum = 0;
+        for (const int* it = vec.data + vec.size; it != vec.data; --it)
+        {
+            sum = sum * 3 + it[-1];
+        }
+        return sum;
+    }
+
+    std::size_t checked_find(const my_vector<int>& vec, int value)
+    {
+        return static_cast<std::size_t>(std::find(vec.begin(), vec.end(), value) - vec.begin());
+    }
+
+    std::size_t raw_find(const raw_vector& vec, int value)
+    {
+        return static_cast<std::size_t>(std::find(vec.data, vec.data + vec.size, value) - vec.data);
+    }
+}
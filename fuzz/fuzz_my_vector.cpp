@@ -0,0 +1,373 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "my_vector.h"
+
+// Differential fuzz target: replays one operation sequence on my_vector and std::vector and
+// traps on the first difference. Tracked elements also catch lifetime bugs that ASan cannot see,
+// such as assigning to a destroyed element that still sits in allocated memory, or leaking one.
+// Built with MY_VECTOR_LIBFUZZER it is a libFuzzer target; otherwise main() replays the files
+// given on the command line, or runs -runs=N random inputs.
+
+namespace
+{
+    constexpr std::uint32_t aliveCanary = 0xa11fe;
+    constexpr std::uint32_t deadCanary = 0xdead;
+
+    long liveTracked = 0;
+
+    [[noreturn]] void fail(const char* what)
+    {
+        std::fprintf(stderr, "fuzz_my_vector: %s\n", what);
+        std::abort();
+    }
+
+    struct Tracked
+    {
+        Tracked(int v = 0) :
+            value(v)
+        {
+            ++liveTracked;
+        }
+
+        Tracked(const Tracked& other) :
+            value(other.checked().value)
+        {
+            ++liveTracked;
+        }
+
+        Tracked(Tracked&& other) noexcept :
+            value(std::exchange(other.checked().value, -1))
+        {
+            ++liveTracked;
+        }
+
+        Tracked& operator=(const Tracked& other)
+        {
+            checked();
+            value = other.checked().value;
+            return *this;
+        }
+
+        Tracked& operator=(Tracked&& other) noexcept
+        {
+            checked();
+            value = std::exchange(other.checked().value, -1);
+            return *this;
+        }
+
+        ~Tracked()
+        {
+            checked();
+            canary = deadCanary;
+            --liveTracked;
+        }
+
+        const Tracked& checked() const
+        {
+            if (canary != aliveCanary)
+            {
+                fail(canary == deadCanary ? "use of a destroyed element" : "use of an unconstructed element");
+            }
+            return *this;
+        }
+
+        Tracked& checked()
+        {
+            std::as_const(*this).checked();
+            return *this;
+        }
+
+        bool operator==(const Tracked& other) const
+        {
+            return checked().value == other.checked().value;
+        }
+
+        int value;
+        std::uint32_t canary = aliveCanary;
+    };
+
+    class ByteReader
+    {
+    public:
+        ByteReader(const std::uint8_t* data, std::size_t size) :
+            m_data(data),
+            m_size(size)
+        {
+        }
+
+        bool is_empty() const noexcept
+        {
+            return m_pos == m_size;
+        }
+
+        std::uint8_t next() noexcept
+        {
+            return m_pos < m_size ? m_data[m_pos++] : 0;
+        }
+
+        // A position in [0, bound], so bound itself stands for end().
+        std::size_t next_pos(std::size_t bound) noexcept
+        {
+            return next() % (bound + 1);
+        }
+
+    private:
+        const std::uint8_t* m_data;
+        std::size_t m_size;
+        std::size_t m_pos = 0;
+    };
+
+    void check_equal(const my_vector<Tracked>& actual, const std::vector<Tracked>& expected)
+    {
+        if (actual.size() != expected.size() || actual.is_empty() != expected.empty())
+        {
+            fail("size differs");
+        }
+        if (actual.capacity() < actual.size())
+        {
+            fail("capacity below size");
+        }
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            if (!(actual[i] == expected[i]))
+            {
+                fail("element differs");
+            }
+        }
+        if (!std::equal(actual.crbegin(), actual.crend(), expected.crbegin(), expected.crend()))
+        {
+            fail("reverse iteration differs");
+        }
+    }
+
+    void run_one(const std::uint8_t* data, std::size_t size)
+    {
+        {
+            my_vector<Tracked> actual;
+            std::vector<Tracked> expected;
+            my_vector<Tracked> actualOther{ 7, 8, 9 };
+            std::vector<Tracked> expectedOther{ 7, 8, 9 };
+
+            ByteReader reader(data, size);
+            while (!reader.is_empty())
+            {
+                const int value = reader.next();
+                switch (reader.next() % 20)
+                {
+                case 0:
+                {
+                    const Tracked elem(value);
+                    actual.push_back(elem);
+                    expected.push_back(elem);
+                    break;
+                }
+                case 1:
+                    actual.push_back(Tracked(value));
+                    expected.push_back(Tracked(value));
+                    break;
+                case 2:
+                    actual.emplace_back(value);
+                    expected.emplace_back(value);
+                    break;
+                case 3:
+                    if (!expected.empty())
+                    {
+                        actual.pop_back();
+                        expected.pop_back();
+                    }
+                    break;
+                case 4:
+                {
+                    const std::size_t pos = reader.next_pos(expected.size());
+                    actual.insert(actual.cbegin() + pos, Tracked(value));
+                    expected.insert(expected.cbegin() + pos, Tracked(value));
+                    break;
+                }
+                case 5:
+                {
+                    const std::size_t pos = reader.next_pos(expected.size());
+                    const std::vector<Tracked> source(reader.next() % 40, Tracked(value));
+                    actual.insert(actual.cbegin() + pos, source.begin(), source.end());
+                    expected.insert(expected.cbegin() + pos, source.begin(), source.end());
+                    break;
+                }
+                case 6:
+                    if (!expected.empty())
+                    {
+                        const std::size_t pos = reader.next_pos(expected.size() - 1);
+                        actual.erase(actual.cbegin() + pos);
+                        expected.erase(expected.cbegin() + pos);
+                    }
+                    break;
+                case 7:
+                {
+                    std::size_t first = reader.next_pos(expected.size());
+                    std::size_t last = reader.next_pos(expected.size());
+                    if (first > last)
+                    {
+                        std::swap(first, last);
+                    }
+                    actual.erase(actual.begin() + first, actual.begin() + last);
+                    expected.erase(expected.begin() + first, expected.begin() + last);
+                    break;
+                }
+                case 8:
+                {
+                    const std::size_t count = reader.next() % 80;
+                    actual.resize(count);
+                    expected.resize(count);
+                    break;
+                }
+                case 9:
+                {
+                    const std::size_t count = reader.next() % 80;
+                    actual.resize(count, Tracked(value));
+                    expected.resize(count, Tracked(value));
+                    break;
+                }
+                case 10:
+                    actual.reserve(reader.next());
+                    break;
+                case 11:
+                    actual.shrink_to_fit();
+                    break;
+                case 12:
+                    actual.clear();
+                    expected.clear();
+                    break;
+                case 13:
+                {
+                    const my_vector<Tracked> copy = actual;
+                    check_equal(copy, expected);
+                    actualOther = copy;
+                    expectedOther = expected;
+                    actual = actual;
+                    break;
+                }
+                case 14:
+                    actualOther = std::move(actual);
+                    expectedOther = std::move(expected);
+                    actual = my_vector<Tracked>{};
+                    expected.clear();
+                    break;
+                case 15:
+                    actual.swap(actualOther);
+                    expected.swap(expectedOther);
+                    break;
+                case 16:
+                    if (!expected.empty())
+                    {
+                        // The argument aliases an element that growth may move.
+                        const std::size_t pos = reader.next_pos(expected.size() - 1);
+                        actual.push_back(actual[pos]);
+                        expected.push_back(expected[pos]);
+                    }
+                    break;
+                case 17:
+                    if (!expected.empty())
+                    {
+                        const std::size_t pos = reader.next_pos(expected.size() - 1);
+                        actual.emplace_back(actual[pos]);
+                        expected.emplace_back(expected[pos]);
+                    }
+                    break;
+                case 18:
+                    if (!expected.empty())
+                    {
+                        const std::size_t pos = reader.next_pos(expected.size() - 1);
+                        const std::size_t count = reader.next() % 80;
+                        actual.resize(count, actual[pos]);
+                        expected.resize(count, expected[pos]);
+                    }
+                    break;
+                case 19:
+                {
+                    bool thrown = false;
+                    try
+                    {
+                        actual.at(expected.size() + value);
+                    }
+                    catch (const my_vector_out_of_range&)
+                    {
+                        thrown = true;
+                    }
+                    if (!thrown)
+                    {
+                        fail("at() past the end did not throw");
+                    }
+                    break;
+                }
+                }
+
+                check_equal(actual, expected);
+                check_equal(actualOther, expectedOther);
+            }
+        }
+
+        if (liveTracked != 0)
+        {
+            fail("elements leaked or destroyed twice");
+        }
+    }
+}
+
+#ifdef MY_VECTOR_LIBFUZZER
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size)
+{
+    run_one(data, size);
+    return 0;
+}
+
+#else
+
+// Usage: fuzz_my_vector [-runs=N] [input files...]
+int main(int argc, char** argv)
+{
+    std::size_t runs = 10000;
+    bool replayed = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strncmp(argv[i], "-runs=", 6) == 0)
+        {
+            runs = std::strtoull(argv[i] + 6, nullptr, 10);
+            continue;
+        }
+
+        std::ifstream file(argv[i], std::ios::binary);
+        const std::string input((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        run_one(reinterpret_cast<const std::uint8_t*>(input.data()), input.size());
+        replayed = true;
+    }
+    if (replayed)
+    {
+        return 0;
+    }
+
+    std::mt19937 gen(20241018);
+    std::vector<std::uint8_t> input;
+    for (std::size_t run = 0; run < runs; ++run)
+    {
+        input.resize(gen() % 512);
+        for (std::uint8_t& byte : input)
+        {
+            byte = static_cast<std::uint8_t>(gen());
+        }
+        run_one(input.data(), input.size());
+    }
+    std::printf("fuzz_my_vector: %zu runs passed\n", runs);
+
+    return 0;
+}
+
+#endif
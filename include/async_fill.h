@@ -0,0 +1,796 @@
+#ifndef ASYNC_FILL_H
+#define ASYNC_FILL_H
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "my_vector.h"
+#include "my_span.h"
+#include "ring_vector.h"
+
+// Loads a my_vector from a file in fixed-size chunks, parsing each chunk while the reads of the
+// next ones are in flight, so a load takes about max(I/O, parse) instead of their sum.
+//
+//     file_source source("edges.txt");
+//     my_vector<edge> edges;
+//     async_fill(edges, source, parse_edges).get();
+//
+// The reads go through io_uring when the kernel allows it, using the raw system calls since
+// liburing is not a dependency, and otherwise through a small pool of threads calling pread.
+// async_fill is a coroutine: it suspends on every read that has not completed yet, and get()
+// drives it on the calling thread, blocking on the read it waits for and resuming it. Parsing
+// therefore always runs on the caller's thread, and the callback needs no locking.
+
+class async_fill_error final : std::exception
+{
+public:
+    explicit async_fill_error(int error) noexcept :
+        m_error(error)
+    {
+    }
+
+    const char* what() const noexcept override
+    {
+        return "async_fill could not read its source";
+    }
+
+    // The errno value of the failed call.
+    int error() const noexcept
+    {
+        return m_error;
+    }
+
+private:
+    int m_error;
+};
+
+enum class read_backend
+{
+    automatic,
+    io_uring,
+    thread_pool
+};
+
+namespace async_fill_detail
+{
+    // A read in flight, or done with its result: the number of bytes read or -errno.
+    struct read_slot
+    {
+        char* buffer = nullptr;
+        std::size_t bytes = 0;
+        std::uint64_t offset = 0;
+        std::ptrdiff_t result = 0;
+        bool done = true;
+        iovec iov{};
+    };
+
+    class unique_fd
+    {
+    public:
+        explicit unique_fd(int fd) noexcept :
+            m_fd(fd)
+        {
+        }
+
+        unique_fd(const unique_fd&) = delete;
+        unique_fd& operator=(const unique_fd&) = delete;
+
+        ~unique_fd()
+        {
+            if (m_fd >= 0)
+            {
+                close(m_fd);
+            }
+        }
+
+        int get() const noexcept
+        {
+            return m_fd;
+        }
+
+    private:
+        int m_fd;
+    };
+
+    inline std::ptrdiff_t pread_retrying(int fd, char* buffer, std::size_t bytes, std::uint64_t offset)
+    {
+        for (;;)
+        {
+            const ssize_t result = pread(fd, buffer, bytes, static_cast<off_t>(offset));
+            if (result >= 0 || errno != EINTR)
+            {
+                return result >= 0 ? result : -errno;
+            }
+        }
+    }
+
+    class uring_reader
+    {
+    public:
+        uring_reader() = default;
+        uring_reader(const uring_reader&) = delete;
+        uring_reader& operator=(const uring_reader&) = delete;
+
+        ~uring_reader()
+        {
+            if (m_sqes != nullptr)
+            {
+                munmap(m_sqes, m_sqesBytes);
+            }
+            if (m_cqRing != nullptr && m_cqRing != m_sqRing)
+            {
+                munmap(m_cqRing, m_cqRingBytes);
+            }
+            if (m_sqRing != nullptr)
+            {
+                munmap(m_sqRing, m_sqRingBytes);
+            }
+            if (m_ring >= 0)
+            {
+                close(m_ring);
+            }
+        }
+
+        // False when the kernel has no io_uring or does not let this process use it.
+        bool open(unsigned entries)
+        {
+            io_uring_params params{};
+            m_ring = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+            if (m_ring < 0)
+            {
+                return false;
+            }
+
+            const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            m_sqRingBytes = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            m_cqRingBytes = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            if (singleMap)
+            {
+                m_sqRingBytes = m_cqRingBytes = std::max(m_sqRingBytes, m_cqRingBytes);
+            }
+            m_sqRing = map(m_sqRingBytes, IORING_OFF_SQ_RING);
+            m_cqRing = singleMap ? m_sqRing : map(m_cqRingBytes, IORING_OFF_CQ_RING);
+            m_sqesBytes = params.sq_entries * sizeof(io_uring_sqe);
+            m_sqes = static_cast<io_uring_sqe*>(map(m_sqesBytes, IORING_OFF_SQES));
+            if (m_sqRing == nullptr || m_cqRing == nullptr || m_sqes == nullptr)
+            {
+                return false;
+            }
+
+            char* const sq = static_cast<char*>(m_sqRing);
+            char* const cq = static_cast<char*>(m_cqRing);
+            m_sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+            m_sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+            m_sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+            m_cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+            m_cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+            m_cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+            m_cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+            return true;
+        }
+
+        void start(int fd, std::size_t slotIndex, read_slot& slot)
+        {
+            const unsigned tail = *m_sqTail;
+            const unsigned index = tail & m_sqMask;
+            io_uring_sqe& sqe = m_sqes[index];
+            sqe = io_uring_sqe{};
+            // A single-buffer readv, since IORING_OP_READ only came with Linux 5.6.
+            slot.iov = iovec{ slot.buffer, slot.bytes };
+            sqe.opcode = IORING_OP_READV;
+            sqe.fd = fd;
+            sqe.addr = reinterpret_cast<std::uintptr_t>(&slot.iov);
+            sqe.len = 1;
+            sqe.off = slot.offset;
+            sqe.user_data = slotIndex;
+            m_sqArray[index] = index;
+            std::atomic_ref<unsigned>(*m_sqTail).store(tail + 1, std::memory_order_release);
+            try
+            {
+                enter(1, 0, 0);
+            }
+            catch (...)
+            {
+                // The kernel took nothing, so take the entry back and leave the slot done, or
+                // waiting for the read would never end.
+                std::atomic_ref<unsigned>(*m_sqTail).store(tail, std::memory_order_release);
+                throw;
+            }
+            slot.done = false;
+        }
+
+        // Moves every completion the kernel has posted into its slot.
+        void reap(read_slot* slots)
+        {
+            unsigned head = *m_cqHead;
+            const unsigned tail = std::atomic_ref<unsigned>(*m_cqTail).load(std::memory_order_acquire);
+            for (; head != tail; ++head)
+            {
+                const io_uring_cqe& cqe = m_cqes[head & m_cqMask];
+                read_slot& slot = slots[cqe.user_data];
+                slot.result = cqe.res;
+                slot.done = true;
+            }
+            std::atomic_ref<unsigned>(*m_cqHead).store(head, std::memory_order_release);
+        }
+
+        void wait_for_completion()
+        {
+            enter(0, 1, IORING_ENTER_GETEVENTS);
+        }
+
+        // False if the ring itself fails, when no completion is coming.
+        bool try_wait_for_completion() noexcept
+        {
+            return syscall(__NR_io_uring_enter, m_ring, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) >= 0 || errno == EINTR;
+        }
+
+    private:
+        void* map(std::size_t bytes, std::uint64_t offset) const
+        {
+            void* const ring = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring, static_cast<off_t>(offset));
+            return ring == MAP_FAILED ? nullptr : ring;
+        }
+
+        void enter(unsigned toSubmit, unsigned minComplete, unsigned flags)
+        {
+            while (syscall(__NR_io_uring_enter, m_ring, toSubmit, minComplete, flags, nullptr, 0) < 0)
+            {
+                if (errno != EINTR)
+                {
+                    throw async_fill_error(errno);
+                }
+            }
+        }
+
+        int m_ring = -1;
+        void* m_sqRing = nullptr;
+        void* m_cqRing = nullptr;
+        io_uring_sqe* m_sqes = nullptr;
+        std::size_t m_sqRingBytes = 0;
+        std::size_t m_cqRingBytes = 0;
+        std::size_t m_sqesBytes = 0;
+        unsigned* m_sqTail = nullptr;
+        unsigned* m_sqArray = nullptr;
+        unsigned* m_cqHead = nullptr;
+        unsigned* m_cqTail = nullptr;
+        io_uring_cqe* m_cqes = nullptr;
+        unsigned m_sqMask = 0;
+        unsigned m_cqMask = 0;
+    };
+
+    // One thread per read that can be in flight, each taking the next queued slot and reading
+    // it with a blocking pread.
+    class pread_pool
+    {
+    public:
+        pread_pool(int fd, read_slot* slots, std::size_t threadsCount) :
+            m_fd(fd),
+            m_slots(slots)
+        {
+            m_threads.reserve(threadsCount);
+            for (std::size_t i = 0; i < threadsCount; ++i)
+            {
+                m_threads.emplace_back([this]() { work(); });
+            }
+        }
+
+        pread_pool(const pread_pool&) = delete;
+        pread_pool& operator=(const pread_pool&) = delete;
+
+        ~pread_pool()
+        {
+            {
+                std::lock_guard lock(m_mutex);
+                m_stopping = true;
+            }
+            m_wake.notify_all();
+        }
+
+        void start(std::size_t slotIndex)
+        {
+            {
+                std::lock_guard lock(m_mutex);
+                m_slots[slotIndex].done = false;
+                m_queue.push_back(slotIndex);
+            }
+            m_wake.notify_one();
+        }
+
+        bool is_done(std::size_t slotIndex)
+        {
+            std::lock_guard lock(m_mutex);
+            return m_slots[slotIndex].done;
+        }
+
+        void wait(std::size_t slotIndex)
+        {
+            std::unique_lock lock(m_mutex);
+            m_finished.wait(lock, [this, slotIndex]() { return m_slots[slotIndex].done; });
+        }
+
+    private:
+        void work()
+        {
+            std::unique_lock lock(m_mutex);
+            for (;;)
+            {
+                m_wake.wait(lock, [this]() { return m_stopping || !m_queue.is_empty(); });
+                if (m_stopping)
+                {
+                    return;
+                }
+                const std::size_t slotIndex = m_queue.front();
+                m_queue.pop_front();
+                const read_slot request = m_slots[slotIndex];
+
+                lock.unlock();
+                const std::ptrdiff_t result = pread_retrying(m_fd, request.buffer, request.bytes, request.offset);
+                lock.lock();
+
+                m_slots[slotIndex].result = result;
+                m_slots[slotIndex].done = true;
+                m_finished.notify_all();
+            }
+        }
+
+        int m_fd;
+        read_slot* m_slots;
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_finished;
+        ring_vector<std::size_t> m_queue;
+        bool m_stopping = false;
+        // Declared last so that the threads are joined before the rest goes.
+        my_vector<std::jthread> m_threads;
+    };
+}
+
+// A regular file read in chunks of chunkBytes, with up to readAhead reads in flight at once.
+// Only the first size() bytes are loaded, as the file was when it was opened.
+class file_source
+{
+public:
+    explicit file_source(const char* path, std::size_t chunkBytes = std::size_t{ 1 } << 20,
+        std::size_t readAhead = 2, read_backend backend = read_backend::automatic) :
+        m_fd(::open(path, O_RDONLY | O_CLOEXEC)),
+        m_chunkBytes(chunkBytes),
+        m_slots(readAhead + 1, async_fill_detail::read_slot{})
+    {
+        if (m_fd.get() < 0)
+        {
+            throw async_fill_error(errno);
+        }
+        // A chunk has to fit the 32-bit length of an io_uring read.
+        if (chunkBytes == 0 || chunkBytes > (std::size_t{ 1 } << 30) || readAhead == 0)
+        {
+            throw async_fill_error(EINVAL);
+        }
+        struct stat status{};
+        if (fstat(m_fd.get(), &status) != 0)
+        {
+            throw async_fill_error(errno);
+        }
+        if (!S_ISREG(status.st_mode))
+        {
+            throw async_fill_error(EINVAL);
+        }
+        m_size = static_cast<std::uint64_t>(status.st_size);
+
+        if (backend != read_backend::thread_pool)
+        {
+            m_uring.emplace();
+            if (m_uring->open(static_cast<unsigned>(m_slots.size())))
+            {
+                m_backend = read_backend::io_uring;
+                return;
+            }
+            m_uring.reset();
+            if (backend == read_backend::io_uring)
+            {
+                throw async_fill_error(ENOSYS);
+            }
+        }
+        m_pool.emplace(m_fd.get(), m_slots.data(), readAhead);
+        m_backend = read_backend::thread_pool;
+    }
+
+    file_source(const file_source&) = delete;
+    file_source& operator=(const file_source&) = delete;
+
+    ~file_source()
+    {
+        wait_all();
+    }
+
+    std::uint64_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    std::size_t chunk_bytes() const noexcept
+    {
+        return m_chunkBytes;
+    }
+
+    std::size_t read_ahead() const noexcept
+    {
+        return m_slots.size() - 1;
+    }
+
+    // The backend in use, never automatic.
+    read_backend backend() const noexcept
+    {
+        return m_backend;
+    }
+
+    // The reads below go through slots 0 to read_ahead(), one read per slot at a time. The
+    // buffer has to stay valid until the read is done.
+    void start_read(std::size_t slotIndex, char* buffer, std::size_t bytes, std::uint64_t offset)
+    {
+        async_fill_detail::read_slot& slot = m_slots[slotIndex];
+        slot.buffer = buffer;
+        slot.bytes = bytes;
+        slot.offset = offset;
+        if (m_uring)
+        {
+            m_uring->start(m_fd.get(), slotIndex, slot);
+        }
+        else
+        {
+            m_pool->start(slotIndex);
+        }
+    }
+
+    bool is_read_done(std::size_t slotIndex)
+    {
+        if (m_pool)
+        {
+            return m_pool->is_done(slotIndex);
+        }
+        if (!m_slots[slotIndex].done)
+        {
+            m_uring->reap(m_slots.data());
+        }
+        return m_slots[slotIndex].done;
+    }
+
+    void wait_read(std::size_t slotIndex)
+    {
+        if (m_pool)
+        {
+            m_pool->wait(slotIndex);
+            return;
+        }
+        while (!is_read_done(slotIndex))
+        {
+            m_uring->wait_for_completion();
+        }
+    }
+
+    // The bytes a finished read got, all of them unless it reached the end of the file.
+    std::size_t read_result(std::size_t slotIndex)
+    {
+        const async_fill_detail::read_slot& slot = m_slots[slotIndex];
+        if (slot.result < 0)
+        {
+            throw async_fill_error(static_cast<int>(-slot.result));
+        }
+        // A regular file only reads short at its end or when interrupted, so finish it here.
+        std::size_t done = static_cast<std::size_t>(slot.result);
+        while (done < slot.bytes && slot.result > 0)
+        {
+            const std::ptrdiff_t more = async_fill_detail::pread_retrying(m_fd.get(), slot.buffer + done, slot.bytes - done, slot.offset + done);
+            if (more < 0)
+            {
+                throw async_fill_error(static_cast<int>(-more));
+            }
+            if (more == 0)
+            {
+                break;
+            }
+            done += static_cast<std::size_t>(more);
+        }
+        return done;
+    }
+
+    // Waits out every read still in flight, so their buffers can go. Errors are left to the
+    // reads' own results.
+    void wait_all() noexcept
+    {
+        for (std::size_t i = 0; i < m_slots.size(); ++i)
+        {
+            if (m_pool)
+            {
+                m_pool->wait(i);
+            }
+            else
+            {
+                m_uring->reap(m_slots.data());
+                while (!m_slots[i].done && m_uring->try_wait_for_completion())
+                {
+                    m_uring->reap(m_slots.data());
+                }
+            }
+        }
+    }
+
+private:
+    async_fill_detail::unique_fd m_fd;
+    std::uint64_t m_size = 0;
+    std::size_t m_chunkBytes;
+    read_backend m_backend = read_backend::automatic;
+    my_vector<async_fill_detail::read_slot> m_slots;
+    std::optional<async_fill_detail::uring_reader> m_uring;
+    std::optional<async_fill_detail::pread_pool> m_pool;
+};
+
+// The running load. Nothing happens until get(), which runs it to the end on the calling
+// thread and rethrows whatever it failed with, from the reads or from the parse callback.
+class [[nodiscard]] fill_task
+{
+public:
+    struct promise_type
+    {
+        fill_task get_return_object()
+        {
+            return fill_task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void() noexcept
+        {
+        }
+
+        void unhandled_exception() noexcept
+        {
+            m_exception = std::current_exception();
+        }
+
+        std::exception_ptr m_exception;
+        // The read the coroutine is suspended on.
+        file_source* m_source = nullptr;
+        std::size_t m_slot = 0;
+    };
+
+    fill_task(fill_task&& other) noexcept :
+        m_handle(std::exchange(other.m_handle, nullptr))
+    {
+    }
+
+    fill_task& operator=(fill_task other) noexcept
+    {
+        std::swap(m_handle, other.m_handle);
+        return *this;
+    }
+
+    ~fill_task()
+    {
+        if (m_handle)
+        {
+            m_handle.destroy();
+        }
+    }
+
+    bool is_done() const noexcept
+    {
+        return !m_handle || m_handle.done();
+    }
+
+    void get()
+    {
+        if (is_done())
+        {
+            return;
+        }
+        m_handle.resume();
+        while (!m_handle.done())
+        {
+            promise_type& promise = m_handle.promise();
+            promise.m_source->wait_read(promise.m_slot);
+            m_handle.resume();
+        }
+        if (m_handle.promise().m_exception)
+        {
+            std::rethrow_exception(std::exchange(m_handle.promise().m_exception, nullptr));
+        }
+    }
+
+private:
+    explicit fill_task(std::coroutine_handle<promise_type> handle) noexcept :
+        m_handle(handle)
+    {
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+namespace async_fill_detail
+{
+    // co_await on a read: suspends only while it is still in flight, and yields its byte count.
+    struct read_awaitable
+    {
+        file_source& source;
+        std::size_t slotIndex;
+
+        bool await_ready()
+        {
+            return source.is_read_done(slotIndex);
+        }
+
+        void await_suspend(std::coroutine_handle<fill_task::promise_type> handle) noexcept
+        {
+            handle.promise().m_source = &source;
+            handle.promise().m_slot = slotIndex;
+        }
+
+        std::size_t await_resume()
+        {
+            return source.read_result(slotIndex);
+        }
+    };
+
+    // Waits for the reads in flight when the load ends early, before their buffers go.
+    struct reads_guard
+    {
+        file_source& source;
+
+        ~reads_guard()
+        {
+            source.wait_all();
+        }
+    };
+
+    // Appends whole elements and leaves the bytes of a split one to the next chunk.
+    struct raw_parser
+    {
+        template <typename Vector>
+        std::size_t operator()(Vector& vec, my_span<const char> bytes, bool) const
+        {
+            using value_type = typename Vector::value_type;
+            const std::size_t count = bytes.size() / sizeof(value_type);
+            const std::size_t oldSize = vec.size();
+            vec.resize(oldSize + count);
+            std::memcpy(static_cast<void*>(vec.data() + oldSize), bytes.data(), count * sizeof(value_type));
+            return count * sizeof(value_type);
+        }
+    };
+}
+
+// Loads source into vec through parse, called as
+//
+//     std::size_t parse(my_vector<...>& vec, my_span<const char> bytes, bool atEnd)
+//
+// with the bytes of each chunk in file order. It appends what it parses from the front of
+// bytes and returns how many bytes it used; the rest comes back at the front of the next call,
+// so a record split across chunks is seen whole. atEnd is true on the last call. Once the
+// first chunk has been parsed, the vector reserves what the whole file should need at that
+// rate, and past that grows by its usual doubling. vec, source and whatever parse refers to
+// have to outlive the task.
+template <typename T, std::size_t Align, typename Storage, typename Layout, typename Parse>
+fill_task async_fill(my_vector<T, Align, Storage, Layout>& vec, file_source& source, Parse parse)
+{
+    const std::uint64_t fileBytes = source.size();
+    const std::size_t chunkBytes = source.chunk_bytes();
+    const std::size_t readAhead = source.read_ahead();
+    const std::size_t slots = readAhead + 1;
+    const std::uint64_t chunks = (fileBytes + chunkBytes - 1) / chunkBytes;
+
+    // Each chunk is read into the back half of its buffer, so the bytes left over from the
+    // chunk before can usually be put in front of it instead of joining the two elsewhere.
+    my_vector<my_vector<char>> buffers(slots, my_vector<char>{});
+    for (my_vector<char>& buffer : buffers)
+    {
+        buffer.resize(2 * chunkBytes);
+    }
+    my_vector<char> carry;
+    std::size_t carrySize = 0;
+
+    async_fill_detail::reads_guard guard{ source };
+    const auto start_chunk = [&](std::uint64_t chunk)
+    {
+        const std::uint64_t offset = chunk * chunkBytes;
+        const std::size_t bytes = static_cast<std::size_t>(std::min<std::uint64_t>(chunkBytes, fileBytes - offset));
+        source.start_read(chunk % slots, buffers[chunk % slots].data() + chunkBytes, bytes, offset);
+    };
+    for (std::uint64_t chunk = 0; chunk < std::min<std::uint64_t>(chunks, readAhead); ++chunk)
+    {
+        start_chunk(chunk);
+    }
+
+    const std::size_t startSize = vec.size();
+    std::uint64_t parsedBytes = 0;
+    bool reserved = false;
+    for (std::uint64_t chunk = 0; chunk < chunks; ++chunk)
+    {
+        const std::size_t read = co_await async_fill_detail::read_awaitable{ source, chunk % slots };
+        // The slot this refills held the chunk before, whose leftover is already in carry.
+        if (chunk + readAhead < chunks)
+        {
+            start_chunk(chunk + readAhead);
+        }
+
+        char* const chunkBegin = buffers[chunk % slots].data() + chunkBytes;
+        my_span<const char> bytes;
+        const bool joined = carrySize > chunkBytes;
+        if (joined)
+        {
+            carry.resize(std::max(carry.size(), carrySize + read));
+            std::memcpy(carry.data() + carrySize, chunkBegin, read);
+            bytes = my_span<const char>(carry.data(), carrySize + read);
+        }
+        else
+        {
+            if (carrySize > 0)
+            {
+                std::memcpy(chunkBegin - carrySize, carry.data(), carrySize);
+            }
+            bytes = my_span<const char>(chunkBegin - carrySize, carrySize + read);
+        }
+
+        const std::size_t consumed = std::min(parse(vec, bytes, chunk + 1 == chunks), bytes.size());
+        parsedBytes += consumed;
+        if (!reserved && vec.size() > startSize && parsedBytes > 0)
+        {
+            // With a little slack for a rate that drifts, unless it is already reserved.
+            const double perByte = static_cast<double>(vec.size() - startSize) / static_cast<double>(parsedBytes);
+            const double expected = static_cast<double>(startSize) + perByte * static_cast<double>(fileBytes);
+            if (expected > static_cast<double>(vec.capacity() + 1))
+            {
+                vec.reserve(static_cast<std::size_t>(expected * 1.125));
+            }
+            reserved = true;
+        }
+
+        carrySize = bytes.size() - consumed;
+        if (carrySize > 0)
+        {
+            if (carry.size() < carrySize)
+            {
+                carry.resize(carrySize);
+            }
+            std::memmove(carry.data(), bytes.data() + consumed, carrySize);
+        }
+    }
+}
+
+// Loads the bytes of source as they are, whole elements only, into a vector of a trivially
+// copyable type. The file's size says how many there are, so this reserves them up front.
+template <typename T, std::size_t Align, typename Storage, typename Layout>
+    requires std::is_trivially_copyable_v<T>
+fill_task async_fill(my_vector<T, Align, Storage, Layout>& vec, file_source& source)
+{
+    vec.reserve(vec.size() + static_cast<std::size_t>(source.size() / sizeof(T)));
+    return async_fill(vec, source, async_fill_detail::raw_parser{});
+}
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef CACHE_LINE_H
+#define CACHE_LINE_H
+
+#include <cstddef>
+
+inline constexpr std::size_t cache_line_size = 64;
+
+#endif
@@ -0,0 +1,330 @@
+#ifndef COW_VECTOR_H
+#define COW_VECTOR_H
+
+#include <cstddef>
+#include <atomic>
+#include <utility>
+#include <initializer_list>
+
+#include "my_vector.h"
+
+// Copy-on-write handle to a reference-counted my_vector. Copies share one buffer; the first
+// mutating call on a shared handle (non-const access, push_back, insert, ...) detaches it by
+// copying the vector. Sharing one buffer between handles in different threads is safe; a
+// single handle must not be used from several threads at once, same as my_vector itself.
+//
+// A mutable reference, pointer or iterator handed out by a handle would otherwise write into
+// the buffer of any copy made later, so handing one out marks the buffer unshareable: copies of
+// that handle get their own buffer until it drops it, through clear() or assignment.
+template <typename T>
+class cow_vector
+{
+    struct Block
+    {
+        explicit Block(my_vector<T> vector) :
+            data{ std::move(vector) }
+        {
+        }
+
+        std::atomic<std::size_t> refs{ 1 };
+        // Only ever cleared on a block with one handle, by that handle.
+        bool shareable = true;
+        my_vector<T> data;
+    };
+
+public:
+    using value_type = T;
+    using iterator = typename my_vector<T>::iterator;
+    using const_iterator = typename my_vector<T>::const_iterator;
+
+    cow_vector() = default;
+
+    cow_vector(std::initializer_list<value_type> initializerList) :
+        m_block{ new Block(my_vector<value_type>(initializerList)) }
+    {
+    }
+
+    explicit cow_vector(my_vector<value_type> vector) :
+        m_block{ new Block(std::move(vector)) }
+    {
+    }
+
+    cow_vector(const cow_vector& other) :
+        m_block{ other.m_block }
+    {
+        if (m_block != nullptr && !m_block->shareable)
+        {
+            m_block = new Block(m_block->data);
+        }
+        else if (m_block != nullptr)
+        {
+            m_block->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    cow_vector(cow_vector&& other) noexcept :
+        m_block{ std::exchange(other.m_block, nullptr) }
+    {
+    }
+
+    ~cow_vector()
+    {
+        release();
+    }
+
+    cow_vector& operator=(const cow_vector& other)
+    {
+        if (this != &other)
+        {
+            cow_vector tmp(other);
+            swap(tmp);
+        }
+
+        return *this;
+    }
+
+    cow_vector& operator=(cow_vector&& other) noexcept
+    {
+        if (this != &other)
+        {
+            cow_vector tmp(std::move(other));
+            swap(tmp);
+        }
+
+        return *this;
+    }
+
+    const my_vector<value_type>& view() const noexcept
+    {
+        static const my_vector<value_type> empty;
+        return m_block != nullptr ? m_block->data : empty;
+    }
+
+    // Gives this handle its own buffer, copying the shared one if needed. The buffer stays its
+    // own, since the returned reference can be used to write to it at any time.
+    my_vector<value_type>& unshare()
+    {
+        my_vector<value_type>& vector = detach();
+        m_block->shareable = false;
+        return vector;
+    }
+
+    bool is_shared() const noexcept
+    {
+        return m_block != nullptr && m_block->refs.load(std::memory_order_acquire) != 1;
+    }
+
+    std::size_t use_count() const noexcept
+    {
+        return m_block != nullptr ? m_block->refs.load(std::memory_order_acquire) : 0;
+    }
+
+    const value_type& at(std::size_t i) const
+    {
+        return view().at(i);
+    }
+
+    value_type& at(std::size_t i)
+    {
+        return unshare().at(i);
+    }
+
+    const value_type& operator[](std::size_t i) const
+    {
+        return view()[i];
+    }
+
+    value_type& operator[](std::size_t i)
+    {
+        return unshare()[i];
+    }
+
+    const value_type& front() const
+    {
+        return view().front();
+    }
+
+    value_type& front()
+    {
+        return unshare().front();
+    }
+
+    const value_type& back() const
+    {
+        return view().back();
+    }
+
+    value_type& back()
+    {
+        return unshare().back();
+    }
+
+    const value_type* data() const noexcept
+    {
+        return view().data();
+    }
+
+    value_type* data()
+    {
+        return unshare().data();
+    }
+
+    bool is_empty() const noexcept
+    {
+        return view().is_empty();
+    }
+
+    std::size_t size() const noexcept
+    {
+        return view().size();
+    }
+
+    std::size_t capacity() const noexcept
+    {
+        return view().capacity();
+    }
+
+    void swap(cow_vector& other) noexcept
+    {
+        std::swap(m_block, other.m_block);
+    }
+
+    iterator begin()
+    {
+        return unshare().begin();
+    }
+
+    iterator end()
+    {
+        return unshare().end();
+    }
+
+    const_iterator begin() const
+    {
+        return view().cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return view().cend();
+    }
+
+    const_iterator cbegin() const
+    {
+        return view().cbegin();
+    }
+
+    const_iterator cend() const
+    {
+        return view().cend();
+    }
+
+    bool operator==(const cow_vector& other) const
+    {
+        return m_block == other.m_block || view() == other.view();
+    }
+
+    void reserve(std::size_t newCapacity)
+    {
+        detach().reserve(newCapacity);
+    }
+
+    void shrink_to_fit()
+    {
+        detach().shrink_to_fit();
+    }
+
+    void push_back(const value_type& elem)
+    {
+        detach().push_back(elem);
+    }
+
+    void push_back(value_type&& elem)
+    {
+        detach().push_back(std::move(elem));
+    }
+
+    template<class... Args>
+    void emplace_back(Args&&... args)
+    {
+        detach().emplace_back(std::forward<Args>(args)...);
+    }
+
+    void pop_back()
+    {
+        detach().pop_back();
+    }
+
+    // Positions are indices: an iterator taken before the call may point into a buffer that the
+    // call detaches from.
+    iterator insert(std::size_t pos, value_type&& elem)
+    {
+        my_vector<value_type>& vector = unshare();
+        return vector.insert(vector.cbegin() + pos, std::move(elem));
+    }
+
+    template <typename InputIt>
+    iterator insert(std::size_t pos, InputIt first, InputIt last)
+    {
+        my_vector<value_type>& vector = unshare();
+        return vector.insert(vector.cbegin() + pos, first, last);
+    }
+
+    iterator erase(std::size_t pos)
+    {
+        my_vector<value_type>& vector = unshare();
+        return vector.erase(vector.cbegin() + pos);
+    }
+
+    iterator erase(std::size_t first, std::size_t last)
+    {
+        my_vector<value_type>& vector = unshare();
+        return vector.erase(vector.begin() + first, vector.begin() + last);
+    }
+
+    // Drops this handle's reference instead of copying a shared buffer just to empty it.
+    void clear()
+    {
+        release();
+        m_block = nullptr;
+    }
+
+    void resize(std::size_t count)
+    {
+        detach().resize(count);
+    }
+
+    void resize(std::size_t count, const value_type& value)
+    {
+        detach().resize(count, value);
+    }
+
+private:
+    my_vector<value_type>& detach()
+    {
+        if (m_block == nullptr)
+        {
+            m_block = new Block(my_vector<value_type>{});
+        }
+        else if (m_block->refs.load(std::memory_order_acquire) != 1)
+        {
+            Block* copy = new Block(m_block->data);
+            release();
+            m_block = copy;
+        }
+
+        return m_block->data;
+    }
+
+    void release() noexcept
+    {
+        if (m_block != nullptr && m_block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            delete m_block;
+        }
+    }
+
+    Block* m_block = nullptr;
+};
+
+#endif
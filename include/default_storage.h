@@ -0,0 +1,15 @@
+#ifndef DEFAULT_STORAGE_H
+#define DEFAULT_STORAGE_H
+
+#include "my_storage.h"
+
+// Storage policy my_vector uses when none is given. Building with MY_VECTOR_THREAD_CACHE
+// switches every such vector to the per-thread buffer cache.
+#ifdef MY_VECTOR_THREAD_CACHE
+#include "thread_cache_storage.h"
+using default_storage = thread_cache_storage;
+#else
+using default_storage = malloc_storage;
+#endif
+
+#endif
@@ -0,0 +1,602 @@
+#ifndef DEVECTOR_H
+#define DEVECTOR_H
+
+#include <cstddef>
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "my_vector.h"
+#include "relocate.h"
+
+// Contiguous buffer with free capacity at both ends, so push_front and pop_front are amortized
+// O(1) like their back counterparts. The elements occupy [m_begin, m_begin + m_size) of the
+// buffer. When one end runs out of room and at least half of the buffer is free, the elements
+// are re-centered in place; otherwise the buffer doubles and they land in the middle of it.
+// Unlike my_vector it never shrinks on its own: work queues that drain and refill would pay for
+// a reallocation every cycle. Emptying it re-centers for free, clear keeps the buffer, and
+// shrink_to_fit gives memory back.
+template <typename T, typename Storage = default_storage>
+class devector
+{
+public:
+    using value_type = T;
+    using storage_type = Storage;
+
+    using iterator = typename my_vector<T, alignof(T), Storage>::iterator;
+    using const_iterator = typename my_vector<T, alignof(T), Storage>::const_iterator;
+    using reverse_iterator = typename my_vector<T, alignof(T), Storage>::reverse_iterator;
+    using const_reverse_iterator = typename my_vector<T, alignof(T), Storage>::const_reverse_iterator;
+
+    devector() = default;
+
+    devector(const devector& other)
+    {
+        reserve_back(other.m_size);
+        insert(end(), other.cbegin(), other.cend());
+    }
+
+    devector(devector&& other) noexcept :
+        m_data{ std::exchange(other.m_data, nullptr) },
+        m_capacity{ std::exchange(other.m_capacity, 0) },
+        m_begin{ std::exchange(other.m_begin, 0) },
+        m_size{ std::exchange(other.m_size, 0) }
+    {
+    }
+
+    devector(std::initializer_list<value_type> initializerList)
+    {
+        reserve_back(initializerList.size());
+        insert(end(), initializerList.begin(), initializerList.end());
+    }
+
+    template <std::input_iterator InputIt>
+    devector(InputIt first, InputIt last)
+    {
+        insert(end(), first, last);
+    }
+
+    devector(std::size_t n, const T& elem)
+    {
+        resize(n, elem);
+    }
+
+    ~devector()
+    {
+        destroy(m_data + m_begin, m_size);
+        deallocate(m_data, m_capacity);
+    }
+
+    devector& operator=(const devector& other)
+    {
+        if (this != &other)
+        {
+            devector tmp(other);
+            swap(tmp);
+        }
+
+        return *this;
+    }
+
+    devector& operator=(devector&& other) noexcept
+    {
+        if (this != &other)
+        {
+            devector tmp(std::move(other));
+            swap(tmp);
+        }
+
+        return *this;
+    }
+
+    devector& operator=(std::initializer_list<value_type> initializerList)
+    {
+        devector tmp(initializerList);
+        swap(tmp);
+
+        return *this;
+    }
+
+    value_type& at(std::size_t i)
+    {
+        if (i < m_size)
+        {
+            return m_data[m_begin + i];
+        }
+        throw my_vector_out_of_range{};
+    }
+
+    const value_type& at(std::size_t i) const
+    {
+        if (i < m_size)
+        {
+            return m_data[m_begin + i];
+        }
+        throw my_vector_out_of_range{};
+    }
+
+    value_type& operator[](std::size_t i)
+    {
+        return m_data[m_begin + i];
+    }
+
+    const value_type& operator[](std::size_t i) const
+    {
+        return m_data[m_begin + i];
+    }
+
+    value_type& front()
+    {
+        return m_data[m_begin];
+    }
+
+    const value_type& front() const
+    {
+        return m_data[m_begin];
+    }
+
+    value_type& back()
+    {
+        return m_data[m_begin + m_size - 1];
+    }
+
+    const value_type& back() const
+    {
+        return m_data[m_begin + m_size - 1];
+    }
+
+    value_type* data() noexcept
+    {
+        return m_data + m_begin;
+    }
+
+    const value_type* data() const noexcept
+    {
+        return m_data + m_begin;
+    }
+
+    bool is_empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    std::size_t capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    // Elements push_front can add before it has to move anything.
+    std::size_t front_free_capacity() const noexcept
+    {
+        return m_begin;
+    }
+
+    // Elements push_back can add before it has to move anything.
+    std::size_t back_free_capacity() const noexcept
+    {
+        return m_capacity - m_begin - m_size;
+    }
+
+    void swap(devector& other) noexcept
+    {
+        std::swap(m_data, other.m_data);
+        std::swap(m_capacity, other.m_capacity);
+        std::swap(m_begin, other.m_begin);
+        std::swap(m_size, other.m_size);
+    }
+
+    iterator begin()
+    {
+        return iterator(data());
+    }
+
+    iterator end()
+    {
+        return iterator(data() + m_size);
+    }
+
+    reverse_iterator rbegin()
+    {
+        return reverse_iterator(data() + m_size);
+    }
+
+    reverse_iterator rend()
+    {
+        return reverse_iterator(data());
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(data());
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(data() + m_size);
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(data());
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(data() + m_size);
+    }
+
+    const_reverse_iterator crbegin() const
+    {
+        return const_reverse_iterator(data() + m_size);
+    }
+
+    const_reverse_iterator crend() const
+    {
+        return const_reverse_iterator(data());
+    }
+
+    template <typename U, typename OtherStorage>
+    bool operator==(const devector<U, OtherStorage>& other) const noexcept
+    {
+        return std::equal(cbegin(), cend(), other.cbegin(), other.cend());
+    }
+
+    template <typename U, typename OtherStorage>
+    auto operator<=>(const devector<U, OtherStorage>& other) const
+    {
+        return std::lexicographical_compare_three_way(cbegin(), cend(), other.cbegin(), other.cend());
+    }
+
+    // Same as reserve_back, so code written against my_vector keeps its meaning.
+    void reserve(std::size_t newCapacity)
+    {
+        reserve_back(newCapacity);
+    }
+
+    // Makes room for push_front to reach count elements without moving the existing ones again.
+    void reserve_front(std::size_t count)
+    {
+        if (m_begin + m_size < count)
+        {
+            reallocate(count + back_free_capacity(), count - m_size);
+        }
+    }
+
+    // Makes room for push_back to reach count elements without moving the existing ones again.
+    void reserve_back(std::size_t count)
+    {
+        if (m_capacity - m_begin < count)
+        {
+            reallocate(m_begin + count, m_begin);
+        }
+    }
+
+    void shrink_to_fit()
+    {
+        if (m_size != m_capacity)
+        {
+            reallocate(m_size, 0);
+        }
+    }
+
+    void push_front(const value_type& elem)
+    {
+        emplace_front(elem);
+    }
+
+    void push_front(value_type&& elem)
+    {
+        emplace_front(std::move(elem));
+    }
+
+    void push_back(const value_type& elem)
+    {
+        emplace_back(elem);
+    }
+
+    void push_back(value_type&& elem)
+    {
+        emplace_back(std::move(elem));
+    }
+
+    template<class... Args>
+    void emplace_front(Args&&... args)
+    {
+        if (m_begin == 0)
+        {
+            // the arguments may refer to one of our elements, which making room is about to move
+            value_type elem(std::forward<Args>(args)...);
+            make_room_front();
+            new(m_data + m_begin - 1) value_type(std::move(elem));
+        }
+        else
+        {
+            new(m_data + m_begin - 1) value_type(std::forward<Args>(args)...);
+        }
+        --m_begin;
+        ++m_size;
+    }
+
+    template<class... Args>
+    void emplace_back(Args&&... args)
+    {
+        if (m_begin + m_size == m_capacity)
+        {
+            value_type elem(std::forward<Args>(args)...);
+            make_room_back();
+            new(m_data + m_begin + m_size) value_type(std::move(elem));
+        }
+        else
+        {
+            new(m_data + m_begin + m_size) value_type(std::forward<Args>(args)...);
+        }
+        ++m_size;
+    }
+
+    void pop_front()
+    {
+        m_data[m_begin].~value_type();
+        ++m_begin;
+        --m_size;
+        recenter_if_empty();
+    }
+
+    void pop_back()
+    {
+        m_data[m_begin + m_size - 1].~value_type();
+        --m_size;
+        recenter_if_empty();
+    }
+
+    // Shifts whichever side of pos is shorter.
+    template<class... Args>
+    iterator emplace(const_iterator pos, Args&&... args)
+    {
+        const std::size_t numPos = pos - cbegin();
+        if (numPos < m_size - numPos)
+        {
+            emplace_front(std::forward<Args>(args)...);
+            std::rotate(begin(), begin() + 1, begin() + numPos + 1);
+        }
+        else
+        {
+            emplace_back(std::forward<Args>(args)...);
+            std::rotate(begin() + numPos, end() - 1, end());
+        }
+
+        return begin() + numPos;
+    }
+
+    iterator insert(const_iterator pos, const value_type& elem)
+    {
+        return emplace(pos, elem);
+    }
+
+    iterator insert(const_iterator pos, value_type&& elem)
+    {
+        return emplace(pos, std::move(elem));
+    }
+
+    template <std::input_iterator InputIt>
+    iterator insert(const_iterator pos, InputIt first, InputIt last)
+    {
+        const std::size_t numPos = pos - cbegin();
+        const std::size_t oldSize = m_size;
+        if (numPos < m_size - numPos)
+        {
+            if constexpr (std::forward_iterator<InputIt>)
+            {
+                grow_front(m_size + static_cast<std::size_t>(std::distance(first, last)));
+            }
+            for (; first != last; ++first)
+            {
+                emplace_front(*first);
+            }
+            const std::size_t count = m_size - oldSize;
+            std::reverse(begin(), begin() + count);
+            std::rotate(begin(), begin() + count, begin() + count + numPos);
+        }
+        else
+        {
+            if constexpr (std::forward_iterator<InputIt>)
+            {
+                grow_back(m_size + static_cast<std::size_t>(std::distance(first, last)));
+            }
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+            std::rotate(begin() + numPos, begin() + oldSize, end());
+        }
+
+        return begin() + numPos;
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    // Like insertion, closes the gap from whichever side has fewer elements to move.
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        const std::size_t numPos = first - cbegin();
+        const std::size_t count = last - first;
+        value_type* elems = data();
+        if (numPos < m_size - numPos - count)
+        {
+            std::move_backward(elems, elems + numPos, elems + numPos + count);
+            destroy(elems, count);
+            m_begin += count;
+        }
+        else
+        {
+            std::move(elems + numPos + count, elems + m_size, elems + numPos);
+            destroy(elems + m_size - count, count);
+        }
+        m_size -= count;
+        recenter_if_empty();
+
+        return begin() + numPos;
+    }
+
+    void clear()
+    {
+        destroy(data(), m_size);
+        m_size = 0;
+        recenter_if_empty();
+    }
+
+    void resize(std::size_t count)
+    {
+        if (count < m_size)
+        {
+            erase(cbegin() + count, cend());
+            return;
+        }
+
+        grow_back(count);
+        for (std::size_t i = m_size; i < count; ++i)
+        {
+            new(m_data + m_begin + i) value_type{};
+        }
+        m_size = count;
+    }
+
+    void resize(std::size_t count, const value_type& value)
+    {
+        if (count < m_size)
+        {
+            erase(cbegin() + count, cend());
+        }
+        else if (m_begin + count > m_capacity)
+        {
+            // value may be one of our elements, which the reallocation is about to move
+            const value_type valueCopy = value;
+            grow_back(count);
+            for (std::size_t i = m_size; i < count; ++i)
+            {
+                new(m_data + m_begin + i) value_type(valueCopy);
+            }
+            m_size = count;
+        }
+        else
+        {
+            for (std::size_t i = m_size; i < count; ++i)
+            {
+                new(m_data + m_begin + i) value_type(value);
+            }
+            m_size = count;
+        }
+    }
+
+private:
+    // Called with no room left in front. Moving the elements is only worth it when that frees
+    // at least as many slots as there are elements, which keeps push_front amortized O(1).
+    void make_room_front()
+    {
+        const std::size_t newCapacity = m_size < m_capacity / 2 ? m_capacity : grown_capacity(m_capacity + 1);
+        const std::size_t newBegin = (newCapacity - m_size + 1) / 2;
+        if (newCapacity == m_capacity)
+        {
+            relocate_elements(m_data + m_begin, m_size, m_data + newBegin);
+            m_begin = newBegin;
+        }
+        else
+        {
+            reallocate(newCapacity, newBegin);
+        }
+    }
+
+    void make_room_back()
+    {
+        const std::size_t newCapacity = m_size < m_capacity / 2 ? m_capacity : grown_capacity(m_capacity + 1);
+        const std::size_t newBegin = (newCapacity - m_size) / 2;
+        if (newCapacity == m_capacity)
+        {
+            relocate_elements(m_data + m_begin, m_size, m_data + newBegin);
+            m_begin = newBegin;
+        }
+        else
+        {
+            reallocate(newCapacity, newBegin);
+        }
+    }
+
+    // reserve_front and reserve_back, but doubling like repeated pushes would.
+    void grow_front(std::size_t count)
+    {
+        if (m_begin + m_size < count)
+        {
+            reserve_front(grown_capacity(count));
+        }
+    }
+
+    void grow_back(std::size_t count)
+    {
+        if (m_capacity - m_begin < count)
+        {
+            reserve_back(grown_capacity(count));
+        }
+    }
+
+    void recenter_if_empty() noexcept
+    {
+        if (m_size == 0)
+        {
+            m_begin = m_capacity / 2;
+        }
+    }
+
+    void reallocate(std::size_t newCapacity, std::size_t newBegin)
+    {
+        value_type* newBuffer = allocate(newCapacity);
+        relocate_elements(m_data + m_begin, m_size, newBuffer + newBegin);
+        deallocate(m_data, m_capacity);
+        m_data = newBuffer;
+        m_capacity = newCapacity;
+        m_begin = newBegin;
+    }
+
+    std::size_t grown_capacity(std::size_t minCapacity) const noexcept
+    {
+        std::size_t newCapacity = m_capacity != 0 ? m_capacity : 1;
+        while (newCapacity < minCapacity)
+        {
+            newCapacity <<= 1;
+        }
+        return newCapacity;
+    }
+
+    static void destroy(value_type* first, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            first[i].~value_type();
+        }
+    }
+
+    static value_type* allocate(std::size_t count)
+    {
+        return static_cast<value_type*>(storage_type::allocate(sizeof(value_type) * count, alignof(value_type)));
+    }
+
+    static void deallocate(value_type* buffer, std::size_t count)
+    {
+        storage_type::deallocate(buffer, sizeof(value_type) * count, alignof(value_type));
+    }
+
+    value_type* m_data = nullptr;
+    std::size_t m_capacity = 0;
+    std::size_t m_begin = 0;
+    std::size_t m_size = 0;
+};
+
+#endif
@@ -0,0 +1,269 @@
+#ifndef FLAT_MAP_H
+#define FLAT_MAP_H
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <initializer_list>
+
+#include "my_vector.h"
+#include "flat_search.h"
+
+class flat_map_out_of_range final : std::exception
+{
+public:
+    const char* what() const noexcept override
+    {
+        return "flat_map out of range";
+    }
+};
+
+class flat_map_size_mismatch final : std::exception
+{
+public:
+    const char* what() const noexcept override
+    {
+        return "flat_map keys and values differ in size";
+    }
+};
+
+template <typename K, typename V, typename Compare = std::less<K>, typename Search = branchless_search<K, Compare>>
+class flat_map
+{
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using key_compare = Compare;
+
+    flat_map() = default;
+
+    flat_map(std::initializer_list<std::pair<key_type, mapped_type>> initializerList)
+    {
+        insert_range(initializerList.begin(), initializerList.end());
+    }
+
+    template <typename InputIt>
+    flat_map(InputIt first, InputIt last)
+    {
+        insert_range(first, last);
+    }
+
+    flat_map(sorted_unique_t, my_vector<key_type> keys, my_vector<mapped_type> values) :
+        m_keys{ std::move(keys) },
+        m_values{ std::move(values) }
+    {
+        if (m_keys.size() != m_values.size())
+        {
+            throw flat_map_size_mismatch{};
+        }
+        m_search.rebuild(m_keys);
+    }
+
+    mapped_type& at(const key_type& key)
+    {
+        const std::size_t i = index_of(key);
+        if (i < size())
+        {
+            return m_values[i];
+        }
+        throw flat_map_out_of_range{};
+    }
+
+    const mapped_type& at(const key_type& key) const
+    {
+        const std::size_t i = index_of(key);
+        if (i < size())
+        {
+            return m_values[i];
+        }
+        throw flat_map_out_of_range{};
+    }
+
+    mapped_type& operator[](const key_type& key)
+    {
+        return m_values[insert(key, mapped_type{}).first];
+    }
+
+    mapped_type* find(const key_type& key)
+    {
+        const std::size_t i = index_of(key);
+        return i < size() ? &m_values[i] : nullptr;
+    }
+
+    const mapped_type* find(const key_type& key) const
+    {
+        const std::size_t i = index_of(key);
+        return i < size() ? &m_values[i] : nullptr;
+    }
+
+    bool contains(const key_type& key) const
+    {
+        return index_of(key) < size();
+    }
+
+    std::size_t lower_bound(const key_type& key) const
+    {
+        return m_search.lower_bound(m_keys, key, m_compare);
+    }
+
+    const my_vector<key_type>& keys() const noexcept
+    {
+        return m_keys;
+    }
+
+    const my_vector<mapped_type>& values() const noexcept
+    {
+        return m_values;
+    }
+
+    my_vector<mapped_type>& values() noexcept
+    {
+        return m_values;
+    }
+
+    bool is_empty() const noexcept
+    {
+        return m_keys.is_empty();
+    }
+
+    std::size_t size() const noexcept
+    {
+        return m_keys.size();
+    }
+
+    void reserve(std::size_t newCapacity)
+    {
+        m_keys.reserve(newCapacity);
+        m_values.reserve(newCapacity);
+    }
+
+    void clear()
+    {
+        m_keys.clear();
+        m_values.clear();
+        m_search.rebuild(m_keys);
+    }
+
+    std::pair<std::size_t, bool> insert(const key_type& key, const mapped_type& value)
+    {
+        const std::size_t i = lower_bound(key);
+        if (i < size() && !m_compare(key, m_keys[i]))
+        {
+            return { i, false };
+        }
+
+        m_keys.insert(m_keys.cbegin() + i, key_type(key));
+        m_values.insert(m_values.cbegin() + i, mapped_type(value));
+        m_search.rebuild(m_keys);
+
+        return { i, true };
+    }
+
+    std::pair<std::size_t, bool> insert_or_assign(const key_type& key, const mapped_type& value)
+    {
+        auto [i, inserted] = insert(key, value);
+        if (!inserted)
+        {
+            m_values[i] = value;
+        }
+
+        return { i, inserted };
+    }
+
+    // Sorts the batch once and merges it with the stored keys, so inserting m elements
+    // costs O(m log m + n) instead of m separate shifts. Keys that are already present keep
+    // their old value, as with insert.
+    template <typename InputIt>
+    void insert_range(InputIt first, InputIt last)
+    {
+        my_vector<key_type> batchKeys;
+        my_vector<mapped_type> batchValues;
+        for (; first != last; ++first)
+        {
+            batchKeys.push_back((*first).first);
+            batchValues.push_back((*first).second);
+        }
+        if (batchKeys.is_empty())
+        {
+            return;
+        }
+
+        my_vector<std::size_t> order;
+        order.resize(batchKeys.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs)
+        {
+            return m_compare(batchKeys[lhs], batchKeys[rhs]);
+        });
+
+        my_vector<key_type> keys;
+        my_vector<mapped_type> values;
+        keys.reserve(m_keys.size() + batchKeys.size());
+        values.reserve(m_values.size() + batchValues.size());
+
+        std::size_t i = 0;
+        std::size_t j = 0;
+        while (i < m_keys.size() || j < order.size())
+        {
+            if (j == order.size() || (i < m_keys.size() && m_compare(m_keys[i], batchKeys[order[j]])))
+            {
+                keys.push_back(std::move(m_keys[i]));
+                values.push_back(std::move(m_values[i]));
+                ++i;
+                continue;
+            }
+
+            const std::size_t pos = order[j++];
+            if (!keys.is_empty() && !m_compare(keys.back(), batchKeys[pos]))
+            {
+                continue;
+            }
+            if (i < m_keys.size() && !m_compare(batchKeys[pos], m_keys[i]))
+            {
+                continue;
+            }
+            keys.push_back(std::move(batchKeys[pos]));
+            values.push_back(std::move(batchValues[pos]));
+        }
+
+        m_keys.swap(keys);
+        m_values.swap(values);
+        m_search.rebuild(m_keys);
+    }
+
+    std::size_t erase(const key_type& key)
+    {
+        const std::size_t i = index_of(key);
+        if (i == size())
+        {
+            return 0;
+        }
+
+        m_keys.erase(m_keys.cbegin() + i);
+        m_values.erase(m_values.cbegin() + i);
+        m_search.rebuild(m_keys);
+
+        return 1;
+    }
+
+private:
+    std::size_t index_of(const key_type& key) const
+    {
+        const std::size_t i = lower_bound(key);
+        if (i < size() && !m_compare(key, m_keys[i]))
+        {
+            return i;
+        }
+        return size();
+    }
+
+    my_vector<key_type> m_keys;
+    my_vector<mapped_type> m_values;
+    [[no_unique_address]] key_compare m_compare;
+    [[no_unique_address]] Search m_search;
+};
+
+#endif
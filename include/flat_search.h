@@ -0,0 +1,98 @@
+#ifndef FLAT_SEARCH_H
+#define FLAT_SEARCH_H
+
+#include <bit>
+#include <cstddef>
+#include <functional>
+
+#include "my_vector.h"
+
+struct sorted_unique_t
+{
+    explicit sorted_unique_t() = default;
+};
+
+inline constexpr sorted_unique_t sorted_unique{};
+
+// Lower bound over the sorted keys with a data-dependent select instead of a branch.
+template <typename K, typename Compare = std::less<K>>
+class branchless_search
+{
+public:
+    void rebuild(const my_vector<K>&)
+    {
+    }
+
+    std::size_t lower_bound(const my_vector<K>& keys, const K& key, const Compare& comp) const
+    {
+        std::size_t count = keys.size();
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        const K* base = keys.data();
+        while (count > 1)
+        {
+            const std::size_t half = count >> 1;
+            base = comp(base[half], key) ? base + half : base;
+            count -= half;
+        }
+
+        return static_cast<std::size_t>(base - keys.data()) + comp(*base, key);
+    }
+};
+
+// Keeps a copy of the keys in Eytzinger (BFS) order, so the first levels of every lookup
+// share the same few cache lines. Needs a rebuild after each modification of the keys.
+template <typename K, typename Compare = std::less<K>>
+class eytzinger_search
+{
+public:
+    void rebuild(const my_vector<K>& keys)
+    {
+        my_vector<std::size_t> rank;
+        rank.resize(keys.size() + 1);
+        std::size_t next = 0;
+        fill_rank(rank, next, 1);
+
+        my_vector<K> layout;
+        layout.reserve(keys.size());
+        for (std::size_t k = 1; k <= keys.size(); ++k)
+        {
+            layout.push_back(keys[rank[k]]);
+        }
+
+        m_layout.swap(layout);
+        m_rank.swap(rank);
+    }
+
+    std::size_t lower_bound(const my_vector<K>& keys, const K& key, const Compare& comp) const
+    {
+        const std::size_t count = m_layout.size();
+        std::size_t k = 1;
+        while (k <= count)
+        {
+            k = (k << 1) + comp(m_layout[k - 1], key);
+        }
+        k >>= std::countr_one(k) + 1;
+
+        return k == 0 ? keys.size() : m_rank[k];
+    }
+
+private:
+    void fill_rank(my_vector<std::size_t>& rank, std::size_t& next, std::size_t k) const
+    {
+        if (k < rank.size())
+        {
+            fill_rank(rank, next, k << 1);
+            rank[k] = next++;
+            fill_rank(rank, next, (k << 1) + 1);
+        }
+    }
+
+    my_vector<K> m_layout;
+    my_vector<std::size_t> m_rank;
+};
+
+#endif
@@ -0,0 +1,156 @@
+#ifndef FLAT_SET_H
+#define FLAT_SET_H
+
+#include <cstddef>
+#include <functional>
+#include <algorithm>
+#include <utility>
+#include <initializer_list>
+
+#include "my_vector.h"
+#include "flat_search.h"
+
+template <typename K, typename Compare = std::less<K>, typename Search = branchless_search<K, Compare>>
+class flat_set
+{
+public:
+    using key_type = K;
+    using value_type = K;
+    using key_compare = Compare;
+    using const_iterator = typename my_vector<key_type>::const_iterator;
+
+    flat_set() = default;
+
+    flat_set(std::initializer_list<key_type> initializerList)
+    {
+        insert_range(initializerList.begin(), initializerList.end());
+    }
+
+    template <typename InputIt>
+    flat_set(InputIt first, InputIt last)
+    {
+        insert_range(first, last);
+    }
+
+    flat_set(sorted_unique_t, my_vector<key_type> keys) :
+        m_keys{ std::move(keys) }
+    {
+        m_search.rebuild(m_keys);
+    }
+
+    bool contains(const key_type& key) const
+    {
+        const std::size_t i = lower_bound(key);
+        return i < size() && !m_compare(key, m_keys[i]);
+    }
+
+    std::size_t lower_bound(const key_type& key) const
+    {
+        return m_search.lower_bound(m_keys, key, m_compare);
+    }
+
+    const my_vector<key_type>& keys() const noexcept
+    {
+        return m_keys;
+    }
+
+    const_iterator begin() const
+    {
+        return m_keys.cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return m_keys.cend();
+    }
+
+    bool is_empty() const noexcept
+    {
+        return m_keys.is_empty();
+    }
+
+    std::size_t size() const noexcept
+    {
+        return m_keys.size();
+    }
+
+    void reserve(std::size_t newCapacity)
+    {
+        m_keys.reserve(newCapacity);
+    }
+
+    void clear()
+    {
+        m_keys.clear();
+        m_search.rebuild(m_keys);
+    }
+
+    std::pair<std::size_t, bool> insert(const key_type& key)
+    {
+        const std::size_t i = lower_bound(key);
+        if (i < size() && !m_compare(key, m_keys[i]))
+        {
+            return { i, false };
+        }
+
+        m_keys.insert(m_keys.cbegin() + i, key_type(key));
+        m_search.rebuild(m_keys);
+
+        return { i, true };
+    }
+
+    template <typename InputIt>
+    void insert_range(InputIt first, InputIt last)
+    {
+        my_vector<key_type> batch;
+        for (; first != last; ++first)
+        {
+            batch.push_back(*first);
+        }
+        if (batch.is_empty())
+        {
+            return;
+        }
+
+        std::sort(batch.begin(), batch.end(), m_compare);
+
+        my_vector<key_type> keys;
+        keys.reserve(m_keys.size() + batch.size());
+
+        std::size_t i = 0;
+        std::size_t j = 0;
+        while (i < m_keys.size() || j < batch.size())
+        {
+            const bool takeOld = j == batch.size() || (i < m_keys.size() && !m_compare(batch[j], m_keys[i]));
+            key_type& next = takeOld ? m_keys[i++] : batch[j++];
+            if (keys.is_empty() || m_compare(keys.back(), next))
+            {
+                keys.push_back(std::move(next));
+            }
+        }
+
+        m_keys.swap(keys);
+        m_search.rebuild(m_keys);
+    }
+
+    std::size_t erase(const key_type& key)
+    {
+        const std::size_t i = lower_bound(key);
+        if (i == size() || m_compare(key, m_keys[i]))
+        {
+            return 0;
+        }
+
+        m_keys.erase(m_keys.cbegin() + i);
+        m_search.rebuild(m_keys);
+
+        return 1;
+    }
+
+private:
+    my_vector<key_type> m_keys;
+    [[no_unique_address]] key_compare m_compare;
+    [[no_unique_address]] Search m_search;
+};
+
+#endif
@@ -0,0 +1,542 @@
+#ifndef GAP_VECTOR_H
+#define GAP_VECTOR_H
+
+#include <cstddef>
+#include <algorithm>
+#include <compare>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "my_span.h"
+#include "my_vector.h"
+#include "relocate.h"
+
+// Gap buffer: the elements fill the buffer except for one run of free slots, the gap, which
+// follows the last edit. Inserting or erasing at the gap is O(1); editing elsewhere first
+// moves the gap there, which costs the distance it travels rather than the length of the tail
+// as in my_vector. Bursts of edits around a cursor therefore stay cheap. Element i lives at
+// index i before the gap and at i + gap_size() after it. It never shrinks on its own.
+template <typename T, typename Storage = default_storage>
+class gap_vector
+{
+    template <typename U>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::remove_cv_t<U>;
+        using pointer = U*;
+        using reference = U&;
+
+        Iterator() = default;
+
+        Iterator(pointer data, std::size_t gapBegin, std::size_t gapSize, std::size_t index) :
+            m_data(data),
+            m_gapBegin(gapBegin),
+            m_gapSize(gapSize),
+            m_index(index)
+        {
+        }
+
+        reference operator*() const { return m_data[physical(m_index)]; }
+        pointer operator->() const { return m_data + physical(m_index); }
+
+        Iterator& operator++()
+        {
+            ++m_index;
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            return Iterator(m_data, m_gapBegin, m_gapSize, m_index++);
+        }
+
+        Iterator& operator--()
+        {
+            --m_index;
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            return Iterator(m_data, m_gapBegin, m_gapSize, m_index--);
+        }
+
+        Iterator& operator+=(difference_type offset)
+        {
+            m_index += offset;
+            return *this;
+        }
+
+        Iterator operator+(difference_type offset) const
+        {
+            return Iterator(m_data, m_gapBegin, m_gapSize, m_index + offset);
+        }
+
+        friend Iterator operator+(difference_type offset, const Iterator& it)
+        {
+            return it + offset;
+        }
+
+        Iterator& operator-=(difference_type offset)
+        {
+            m_index -= offset;
+            return *this;
+        }
+
+        Iterator operator-(difference_type offset) const
+        {
+            return Iterator(m_data, m_gapBegin, m_gapSize, m_index - offset);
+        }
+
+        difference_type operator-(const Iterator& other) const
+        {
+            return static_cast<difference_type>(m_index - other.m_index);
+        }
+
+        reference operator[](difference_type index) const
+        {
+            return m_data[physical(m_index + index)];
+        }
+
+        bool operator==(const Iterator& other) const
+        {
+            return m_index == other.m_index;
+        }
+
+        auto operator<=>(const Iterator& other) const
+        {
+            return m_index <=> other.m_index;
+        }
+
+        operator Iterator<const value_type>() const
+        {
+            return Iterator<const value_type>(m_data, m_gapBegin, m_gapSize, m_index);
+        }
+
+    private:
+        std::size_t physical(std::size_t index) const noexcept
+        {
+            return index < m_gapBegin ? index : index + m_gapSize;
+        }
+
+        pointer m_data = nullptr;
+        std::size_t m_gapBegin = 0;
+        std::size_t m_gapSize = 0;
+        std::size_t m_index = 0;
+    };
+
+public:
+    using value_type = T;
+    using storage_type = Storage;
+
+    using iterator = Iterator<value_type>;
+    using const_iterator = Iterator<const value_type>;
+
+    gap_vector() = default;
+
+    gap_vector(const gap_vector& other)
+    {
+        insert(cend(), other.cbegin(), other.cend());
+    }
+
+    gap_vector(gap_vector&& other) noexcept :
+        m_data{ std::exchange(other.m_data, nullptr) },
+        m_capacity{ std::exchange(other.m_capacity, 0) },
+        m_gapBegin{ std::exchange(other.m_gapBegin, 0) },
+        m_gapEnd{ std::exchange(other.m_gapEnd, 0) }
+    {
+    }
+
+    gap_vector(std::initializer_list<value_type> initializerList)
+    {
+        insert(cend(), initializerList.begin(), initializerList.end());
+    }
+
+    template <std::input_iterator InputIt>
+    gap_vector(InputIt first, InputIt last)
+    {
+        insert(cend(), first, last);
+    }
+
+    ~gap_vector()
+    {
+        destroy(m_data, m_gapBegin);
+        destroy(m_data + m_gapEnd, m_capacity - m_gapEnd);
+        deallocate(m_data, m_capacity);
+    }
+
+    gap_vector& operator=(const gap_vector& other)
+    {
+        if (this != &other)
+        {
+            gap_vector tmp(other);
+            swap(tmp);
+        }
+
+        return *this;
+    }
+
+    gap_vector& operator=(gap_vector&& other) noexcept
+    {
+        if (this != &other)
+        {
+            gap_vector tmp(std::move(other));
+            swap(tmp);
+        }
+
+        return *this;
+    }
+
+    value_type& at(std::size_t i)
+    {
+        if (i < size())
+        {
+            return m_data[physical(i)];
+        }
+        throw my_vector_out_of_range{};
+    }
+
+    const value_type& at(std::size_t i) const
+    {
+        if (i < size())
+        {
+            return m_data[physical(i)];
+        }
+        throw my_vector_out_of_range{};
+    }
+
+    value_type& operator[](std::size_t i)
+    {
+        return m_data[physical(i)];
+    }
+
+    const value_type& operator[](std::size_t i) const
+    {
+        return m_data[physical(i)];
+    }
+
+    value_type& front()
+    {
+        return (*this)[0];
+    }
+
+    const value_type& front() const
+    {
+        return (*this)[0];
+    }
+
+    value_type& back()
+    {
+        return (*this)[size() - 1];
+    }
+
+    const value_type& back() const
+    {
+        return (*this)[size() - 1];
+    }
+
+    bool is_empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return m_capacity - gap_size();
+    }
+
+    std::size_t capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    // Index of the element right after the gap, i.e. where the last edit happened.
+    std::size_t gap_position() const noexcept
+    {
+        return m_gapBegin;
+    }
+
+    std::size_t gap_size() const noexcept
+    {
+        return m_gapEnd - m_gapBegin;
+    }
+
+    // Moves the gap to the end and returns the elements as one contiguous run. The span stays
+    // valid until the next edit; my_vector<T>(begin(), end()) makes an owning copy instead.
+    my_span<value_type> flatten()
+    {
+        move_gap(size());
+        return my_span<value_type>(m_data, m_gapBegin);
+    }
+
+    void swap(gap_vector& other) noexcept
+    {
+        std::swap(m_data, other.m_data);
+        std::swap(m_capacity, other.m_capacity);
+        std::swap(m_gapBegin, other.m_gapBegin);
+        std::swap(m_gapEnd, other.m_gapEnd);
+    }
+
+    iterator begin()
+    {
+        return iterator(m_data, m_gapBegin, gap_size(), 0);
+    }
+
+    iterator end()
+    {
+        return iterator(m_data, m_gapBegin, gap_size(), size());
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(m_data, m_gapBegin, gap_size(), 0);
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(m_data, m_gapBegin, gap_size(), size());
+    }
+
+    const_iterator cbegin() const
+    {
+        return begin();
+    }
+
+    const_iterator cend() const
+    {
+        return end();
+    }
+
+    template <typename U, typename OtherStorage>
+    bool operator==(const gap_vector<U, OtherStorage>& other) const
+    {
+        return std::equal(cbegin(), cend(), other.cbegin(), other.cend());
+    }
+
+    template <typename U, typename OtherStorage>
+    auto operator<=>(const gap_vector<U, OtherStorage>& other) const
+    {
+        return std::lexicographical_compare_three_way(cbegin(), cend(), other.cbegin(), other.cend());
+    }
+
+    void reserve(std::size_t newCapacity)
+    {
+        if (m_capacity < newCapacity)
+        {
+            reallocate(newCapacity);
+        }
+    }
+
+    void shrink_to_fit()
+    {
+        if (gap_size() != 0)
+        {
+            reallocate(size());
+        }
+    }
+
+    void push_back(const value_type& elem)
+    {
+        emplace(cend(), elem);
+    }
+
+    void push_back(value_type&& elem)
+    {
+        emplace(cend(), std::move(elem));
+    }
+
+    void pop_back()
+    {
+        erase(cend() - 1);
+    }
+
+    template<class... Args>
+    iterator emplace(const_iterator pos, Args&&... args)
+    {
+        const std::size_t numPos = pos - cbegin();
+        if (numPos == m_gapBegin && m_gapBegin != m_gapEnd)
+        {
+            new(m_data + m_gapBegin) value_type(std::forward<Args>(args)...);
+        }
+        else
+        {
+            // the arguments may refer to one of the elements the gap is about to move
+            value_type elem(std::forward<Args>(args)...);
+            make_gap(numPos, 1);
+            new(m_data + m_gapBegin) value_type(std::move(elem));
+        }
+        ++m_gapBegin;
+
+        return begin() + numPos;
+    }
+
+    iterator insert(const_iterator pos, const value_type& elem)
+    {
+        return emplace(pos, elem);
+    }
+
+    iterator insert(const_iterator pos, value_type&& elem)
+    {
+        return emplace(pos, std::move(elem));
+    }
+
+    template <std::input_iterator InputIt>
+    iterator insert(const_iterator pos, InputIt first, InputIt last)
+    {
+        const std::size_t numPos = pos - cbegin();
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            make_gap(numPos, static_cast<std::size_t>(std::distance(first, last)));
+            for (; first != last; ++first)
+            {
+                new(m_data + m_gapBegin) value_type(*first);
+                ++m_gapBegin;
+            }
+        }
+        else
+        {
+            for (std::size_t i = numPos; first != last; ++first, ++i)
+            {
+                emplace(cbegin() + i, *first);
+            }
+        }
+
+        return begin() + numPos;
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    // Erasing just before the gap, like a backspace at the cursor, moves nothing.
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        const std::size_t numFirst = first - cbegin();
+        const std::size_t numLast = last - cbegin();
+        const std::size_t count = numLast - numFirst;
+        if (numLast <= m_gapBegin)
+        {
+            move_gap(numLast);
+            destroy(m_data + numFirst, count);
+            m_gapBegin = numFirst;
+        }
+        else
+        {
+            move_gap(numFirst);
+            destroy(m_data + m_gapEnd, count);
+            m_gapEnd += count;
+        }
+
+        return begin() + numFirst;
+    }
+
+    void clear()
+    {
+        erase(cbegin(), cend());
+    }
+
+private:
+    std::size_t physical(std::size_t i) const noexcept
+    {
+        return i < m_gapBegin ? i : i + gap_size();
+    }
+
+    // Moves the gap so that it starts before element pos, shifting the elements in between
+    // across it.
+    void move_gap(std::size_t pos)
+    {
+        if (pos < m_gapBegin)
+        {
+            const std::size_t count = m_gapBegin - pos;
+            relocate_elements(m_data + pos, count, m_data + m_gapEnd - count);
+            m_gapBegin -= count;
+            m_gapEnd -= count;
+        }
+        else if (pos > m_gapBegin)
+        {
+            const std::size_t count = pos - m_gapBegin;
+            relocate_elements(m_data + m_gapEnd, count, m_data + m_gapBegin);
+            m_gapBegin += count;
+            m_gapEnd += count;
+        }
+    }
+
+    // Puts a gap of at least count slots before element pos. When the buffer has to grow the
+    // elements are copied around the new gap directly instead of moving the gap first.
+    void make_gap(std::size_t pos, std::size_t count)
+    {
+        if (gap_size() >= count)
+        {
+            move_gap(pos);
+            return;
+        }
+
+        std::size_t newCapacity = m_capacity != 0 ? m_capacity : 1;
+        while (newCapacity - size() < count)
+        {
+            newCapacity <<= 1;
+        }
+        reallocate(newCapacity, pos);
+    }
+
+    void reallocate(std::size_t newCapacity)
+    {
+        reallocate(newCapacity, m_gapBegin);
+    }
+
+    // Lays the elements out in a new buffer with the gap before element pos.
+    void reallocate(std::size_t newCapacity, std::size_t pos)
+    {
+        const std::size_t count = size();
+        const std::size_t newGapEnd = newCapacity - (count - pos);
+        value_type* newBuffer = allocate(newCapacity);
+        if (pos <= m_gapBegin)
+        {
+            relocate_elements(m_data, pos, newBuffer);
+            relocate_elements(m_data + pos, m_gapBegin - pos, newBuffer + newGapEnd);
+            relocate_elements(m_data + m_gapEnd, m_capacity - m_gapEnd, newBuffer + newGapEnd + m_gapBegin - pos);
+        }
+        else
+        {
+            relocate_elements(m_data, m_gapBegin, newBuffer);
+            relocate_elements(m_data + m_gapEnd, pos - m_gapBegin, newBuffer + m_gapBegin);
+            relocate_elements(m_data + m_gapEnd + pos - m_gapBegin, count - pos, newBuffer + newGapEnd);
+        }
+        deallocate(m_data, m_capacity);
+        m_data = newBuffer;
+        m_capacity = newCapacity;
+        m_gapBegin = pos;
+        m_gapEnd = newGapEnd;
+    }
+
+    static void destroy(value_type* first, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            first[i].~value_type();
+        }
+    }
+
+    static value_type* allocate(std::size_t count)
+    {
+        return static_cast<value_type*>(storage_type::allocate(sizeof(value_type) * count, alignof(value_type)));
+    }
+
+    static void deallocate(value_type* buffer, std::size_t count)
+    {
+        storage_type::deallocate(buffer, sizeof(value_type) * count, alignof(value_type));
+    }
+
+    value_type* m_data = nullptr;
+    std::size_t m_capacity = 0;
+    std::size_t m_gapBegin = 0;
+    std::size_t m_gapEnd = 0;
+};
+
+#endif
@@ -0,0 +1,238 @@
+#ifndef GATHER_SCATTER_H
+#define GATHER_SCATTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <concepts>
+#include <exception>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+class gather_scatter_size_mismatch final : std::exception
+{
+public:
+    const char* what() const noexcept override
+    {
+        return "gather/scatter ranges differ in size";
+    }
+};
+
+// How many elements ahead of the current one the table is prefetched. Sixteen covers DRAM
+// latency for a simple copy loop; 0 turns prefetching off, which is faster for tables that
+// already sit in L1 or L2.
+inline constexpr std::size_t default_prefetch_distance = 16;
+
+namespace gather_detail
+{
+    enum class simd_level
+    {
+        none,
+        avx2,
+        avx512
+    };
+
+    inline simd_level detected_simd_level()
+    {
+#if defined(__x86_64__)
+        static const simd_level level = __builtin_cpu_supports("avx512f") ? simd_level::avx512
+            : __builtin_cpu_supports("avx2") ? simd_level::avx2 : simd_level::none;
+        return level;
+#else
+        return simd_level::none;
+#endif
+    }
+
+    template <typename T, typename Index>
+    void gather_scalar(const T* table, const Index* indices, T* out, std::size_t first, std::size_t n, std::size_t distance)
+    {
+        std::size_t i = first;
+        if (distance != 0)
+        {
+            for (; i + distance < n; ++i)
+            {
+                __builtin_prefetch(table + indices[i + distance]);
+                out[i] = table[indices[i]];
+            }
+        }
+        for (; i < n; ++i)
+        {
+            out[i] = table[indices[i]];
+        }
+    }
+
+#if defined(__x86_64__)
+    // Gathers eight 4- or 8-byte elements per instruction, prefetching their successors first.
+    // Returns how many elements were done; the scalar loop finishes the rest.
+    template <typename T>
+    __attribute__((target("avx2"))) std::size_t gather_avx2(const T* table, const std::uint32_t* indices, T* out, std::size_t n, std::size_t distance)
+    {
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            if (i + distance + 8 <= n)
+            {
+                for (std::size_t j = 0; j < 8; ++j)
+                {
+                    __builtin_prefetch(table + indices[i + distance + j]);
+                }
+            }
+
+            if constexpr (sizeof(T) == 4)
+            {
+                const __m256i index = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+                const __m256i values = _mm256_i32gather_epi32(reinterpret_cast<const int*>(table), index, 4);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), values);
+            }
+            else
+            {
+                const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+                const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i + 4));
+                const auto* base = reinterpret_cast<const long long*>(table);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_i32gather_epi64(base, low, 8));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i + 4), _mm256_i32gather_epi64(base, high, 8));
+            }
+        }
+
+        return i;
+    }
+
+    template <typename T>
+    __attribute__((target("avx512f"))) std::size_t gather_avx512(const T* table, const std::uint32_t* indices, T* out, std::size_t n, std::size_t distance)
+    {
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16)
+        {
+            if (i + distance + 16 <= n)
+            {
+                for (std::size_t j = 0; j < 16; ++j)
+                {
+                    __builtin_prefetch(table + indices[i + distance + j]);
+                }
+            }
+
+            const __m512i index = _mm512_loadu_si512(indices + i);
+            if constexpr (sizeof(T) == 4)
+            {
+                _mm512_storeu_si512(out + i, _mm512_i32gather_epi32(index, table, 4));
+            }
+            else
+            {
+                _mm512_storeu_si512(out + i, _mm512_i32gather_epi64(_mm512_castsi512_si256(index), table, 8));
+                _mm512_storeu_si512(out + i + 8, _mm512_i32gather_epi64(_mm512_extracti64x4_epi64(index, 1), table, 8));
+            }
+        }
+
+        return i;
+    }
+#endif
+
+    // The gather instructions take signed 32-bit indices, so they only apply to tables that
+    // 32-bit indices can fully address, and only to trivially copyable 4- and 8-byte elements.
+    template <typename T, typename Index>
+    void gather_simd(const T* table, std::size_t tableSize, const Index* indices, T* out, std::size_t n, std::size_t distance)
+    {
+        std::size_t done = 0;
+#if defined(__x86_64__)
+        if constexpr ((sizeof(T) == 4 || sizeof(T) == 8) && std::is_trivially_copyable_v<T>
+            && std::same_as<std::make_unsigned_t<Index>, std::uint32_t>)
+        {
+            if (tableSize <= static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()))
+            {
+                const auto* unsignedIndices = reinterpret_cast<const std::uint32_t*>(indices);
+                switch (detected_simd_level())
+                {
+                case simd_level::avx512:
+                    done = gather_avx512(table, unsignedIndices, out, n, distance);
+                    break;
+                case simd_level::avx2:
+                    done = gather_avx2(table, unsignedIndices, out, n, distance);
+                    break;
+                case simd_level::none:
+                    break;
+                }
+            }
+        }
+#endif
+        gather_scalar(table, indices, out, done, n, distance);
+    }
+
+    template <typename Out, typename Indices>
+    void check_sizes(const Out& out, const Indices& indices)
+    {
+        if (std::ranges::size(out) < std::ranges::size(indices))
+        {
+            throw gather_scatter_size_mismatch{};
+        }
+    }
+}
+
+// out[i] = table[indices[i]] for every index. Indices are not bounds checked, same as
+// operator[]. Works on my_vector, my_array, my_span or any other contiguous range.
+template <std::ranges::contiguous_range Table, std::ranges::contiguous_range Indices, std::ranges::contiguous_range Out>
+    requires std::integral<std::ranges::range_value_t<Indices>>
+void gather(const Table& table, const Indices& indices, Out&& out, std::size_t prefetchDistance = default_prefetch_distance)
+{
+    gather_detail::check_sizes(out, indices);
+    gather_detail::gather_scalar(std::ranges::data(table), std::ranges::data(indices), std::ranges::data(out),
+        0, std::ranges::size(indices), prefetchDistance);
+}
+
+// Same as gather, but uses the AVX2 or AVX-512 gather instructions when the CPU has them. They
+// are not the default: on the machines bench_gather has run on they were no faster than the
+// scalar loop, whose loads the core already overlaps, and slower for cache-resident tables.
+template <std::ranges::contiguous_range Table, std::ranges::contiguous_range Indices, std::ranges::contiguous_range Out>
+    requires std::integral<std::ranges::range_value_t<Indices>>
+void gather_simd(const Table& table, const Indices& indices, Out&& out, std::size_t prefetchDistance = default_prefetch_distance)
+{
+    gather_detail::check_sizes(out, indices);
+    gather_detail::gather_simd(std::ranges::data(table), std::ranges::size(table), std::ranges::data(indices),
+        std::ranges::data(out), std::ranges::size(indices), prefetchDistance);
+}
+
+// table[indices[i]] = values[i]. With repeated indices the last value wins.
+template <std::ranges::contiguous_range Table, std::ranges::contiguous_range Indices, std::ranges::contiguous_range Values>
+    requires std::integral<std::ranges::range_value_t<Indices>>
+void scatter(Table&& table, const Indices& indices, const Values& values, std::size_t prefetchDistance = default_prefetch_distance)
+{
+    gather_detail::check_sizes(values, indices);
+    auto* base = std::ranges::data(table);
+    const auto* index = std::ranges::data(indices);
+    const auto* value = std::ranges::data(values);
+    const std::size_t n = std::ranges::size(indices);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (i + prefetchDistance < n && prefetchDistance != 0)
+        {
+            __builtin_prefetch(base + index[i + prefetchDistance], 1);
+        }
+        base[index[i]] = value[i];
+    }
+}
+
+// table[indices[i]] += values[i]. Repeated indices accumulate every value, which is why there
+// is no vector scatter path: lanes hitting the same slot would lose updates.
+template <std::ranges::contiguous_range Table, std::ranges::contiguous_range Indices, std::ranges::contiguous_range Values>
+    requires std::integral<std::ranges::range_value_t<Indices>>
+void scatter_add(Table&& table, const Indices& indices, const Values& values, std::size_t prefetchDistance = default_prefetch_distance)
+{
+    gather_detail::check_sizes(values, indices);
+    auto* base = std::ranges::data(table);
+    const auto* index = std::ranges::data(indices);
+    const auto* value = std::ranges::data(values);
+    const std::size_t n = std::ranges::size(indices);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (i + prefetchDistance < n && prefetchDistance != 0)
+        {
+            __builtin_prefetch(base + index[i + prefetchDistance], 1);
+        }
+        base[index[i]] += value[i];
+    }
+}
+
+#endif
@@ -0,0 +1,130 @@
+#ifndef HUGE_PAGE_STORAGE_H
+#define HUGE_PAGE_STORAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <fstream>
+#include <new>
+#include <string>
+
+#include <sys/mman.h>
+
+#include "my_storage.h"
+
+inline constexpr std::size_t huge_page_size = std::size_t{ 2 } << 20;
+
+struct huge_page_counters
+{
+    std::atomic<std::size_t> mappedAllocations{ 0 };
+    std::atomic<std::size_t> hugetlbAllocations{ 0 };
+    std::atomic<std::size_t> hugetlbFailures{ 0 };
+    std::atomic<std::size_t> madviseFailures{ 0 };
+    std::atomic<std::size_t> liveMappedBytes{ 0 };
+};
+
+inline huge_page_counters& huge_page_stats()
+{
+    static huge_page_counters counters;
+    return counters;
+}
+
+// Bytes of anonymous memory the kernel actually backs with transparent huge pages for this
+// process, or 0 if /proc is unavailable. Compare with huge_page_stats().liveMappedBytes.
+inline std::size_t anon_huge_pages_bytes()
+{
+    std::ifstream rollup("/proc/self/smaps_rollup");
+    std::string field;
+    std::size_t kilobytes = 0;
+    while (rollup >> field)
+    {
+        if (field == "AnonHugePages:")
+        {
+            rollup >> kilobytes;
+            return kilobytes << 10;
+        }
+    }
+    return 0;
+}
+
+// Buffers of at least Threshold bytes are mmap'ed at 2 MB alignment and marked MADV_HUGEPAGE,
+// so the kernel can back them with transparent huge pages. With ExplicitHugetlb the mapping is
+// first requested from the reserved MAP_HUGETLB pool and falls back to the THP path if the pool
+// is empty. Smaller buffers go through malloc_storage.
+template <std::size_t Threshold = (std::size_t{ 32 } << 20), bool ExplicitHugetlb = false>
+struct huge_page_storage
+{
+    static void* allocate(std::size_t bytes, std::size_t alignment)
+    {
+        if (bytes < Threshold)
+        {
+            return malloc_storage::allocate(bytes, alignment);
+        }
+
+        huge_page_counters& stats = huge_page_stats();
+        const std::size_t length = mapped_length(bytes);
+
+        if constexpr (ExplicitHugetlb)
+        {
+            void* ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (ptr != MAP_FAILED)
+            {
+                ++stats.mappedAllocations;
+                ++stats.hugetlbAllocations;
+                stats.liveMappedBytes += length;
+                return ptr;
+            }
+            ++stats.hugetlbFailures;
+        }
+
+        // Over-map by one huge page and trim both ends to get a 2 MB aligned start.
+        void* raw = mmap(nullptr, length + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED)
+        {
+            throw std::bad_alloc{};
+        }
+
+        const auto rawStart = reinterpret_cast<std::uintptr_t>(raw);
+        const std::uintptr_t start = (rawStart + huge_page_size - 1) & ~(huge_page_size - 1);
+        if (start != rawStart)
+        {
+            munmap(raw, start - rawStart);
+        }
+        const std::size_t tail = rawStart + length + huge_page_size - (start + length);
+        if (tail != 0)
+        {
+            munmap(reinterpret_cast<void*>(start + length), tail);
+        }
+
+        auto ptr = reinterpret_cast<void*>(start);
+        if (madvise(ptr, length, MADV_HUGEPAGE) != 0)
+        {
+            ++stats.madviseFailures;
+        }
+        ++stats.mappedAllocations;
+        stats.liveMappedBytes += length;
+
+        return ptr;
+    }
+
+    static void deallocate(void* ptr, std::size_t bytes, std::size_t alignment)
+    {
+        if (bytes < Threshold)
+        {
+            malloc_storage::deallocate(ptr, bytes, alignment);
+            return;
+        }
+
+        const std::size_t length = mapped_length(bytes);
+        munmap(ptr, length);
+        huge_page_stats().liveMappedBytes -= length;
+    }
+
+private:
+    static std::size_t mapped_length(std::size_t bytes)
+    {
+        return (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+    }
+};
+
+#endif
@@ -0,0 +1,321 @@
+#ifndef JAGGED_VECTOR_H
+#define JAGGED_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <initializer_list>
+
+#include "my_span.h"
+#include "my_vector.h"
+
+struct from_row_value_pairs_t
+{
+    explicit from_row_value_pairs_t() = default;
+};
+
+inline constexpr from_row_value_pairs_t from_row_value_pairs{};
+
+// Rows of different lengths in compressed sparse row form, for what would otherwise be a
+// my_vector<my_vector<T>>: every row's elements follow each other in one my_vector, and row i
+// is values()[offsets()[i], offsets()[i + 1]). Reading the rows in order streams through two
+// buffers instead of chasing one pointer per row. Rows are appended at the end; building from
+// (row, value) pairs in any order is a counting sort. A smaller Offset, such as std::uint32_t,
+// halves the offsets when there are fewer than 2^32 elements.
+template <typename T, typename Offset = std::size_t>
+class jagged_vector
+{
+    static_assert(std::is_unsigned_v<Offset>, "jagged_vector offsets must be unsigned");
+
+    template <typename U>
+    class RowIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = my_span<U>;
+        using reference = my_span<U>;
+
+        RowIterator() = default;
+
+        RowIterator(U* values, const Offset* offset) :
+            m_values(values),
+            m_offset(offset)
+        {
+        }
+
+        my_span<U> operator*() const
+        {
+            return my_span<U>(m_values + m_offset[0], m_offset[1] - m_offset[0]);
+        }
+
+        RowIterator& operator++()
+        {
+            ++m_offset;
+            return *this;
+        }
+
+        RowIterator operator++(int)
+        {
+            RowIterator old = *this;
+            ++m_offset;
+            return old;
+        }
+
+        bool operator==(const RowIterator& other) const
+        {
+            return m_offset == other.m_offset;
+        }
+
+    private:
+        U* m_values = nullptr;
+        const Offset* m_offset = nullptr;
+    };
+
+public:
+    using value_type = T;
+    using offset_type = Offset;
+    using iterator = RowIterator<value_type>;
+    using const_iterator = RowIterator<const value_type>;
+
+    jagged_vector() = default;
+
+    jagged_vector(std::initializer_list<std::initializer_list<value_type>> rows)
+    {
+        reserve(rows.size(), 0);
+        for (const auto& row : rows)
+        {
+            append_row(row);
+        }
+    }
+
+    // Row r holds the values of the pairs (r, value) in the order they come in. Two passes over
+    // the pairs: one counts the row lengths, the other places every value at its row's cursor.
+    template <std::forward_iterator ForwardIt>
+    jagged_vector(from_row_value_pairs_t, std::size_t rowCount, ForwardIt first, ForwardIt last)
+    {
+        // Bounds every row's count too, so none can wrap a narrow Offset.
+        const std::size_t total = static_cast<std::size_t>(std::distance(first, last));
+        checked_offset(total);
+        if (rowCount == 0)
+        {
+            if (total != 0)
+            {
+                throw my_vector_out_of_range{};
+            }
+            return;
+        }
+
+        m_offsets.resize(rowCount + 1, Offset{ 0 });
+        for (ForwardIt it = first; it != last; ++it)
+        {
+            const std::size_t row = static_cast<std::size_t>(it->first);
+            if (row >= rowCount)
+            {
+                throw my_vector_out_of_range{};
+            }
+            ++m_offsets[row + 1];
+        }
+
+        for (std::size_t row = 1; row <= rowCount; ++row)
+        {
+            m_offsets[row] += m_offsets[row - 1];
+        }
+
+        // The cursors start at each row's begin and end at the next row's.
+        my_vector<Offset> cursors(m_offsets.cbegin(), m_offsets.cend() - 1);
+        m_values.resize(total);
+        for (; first != last; ++first)
+        {
+            m_values[cursors[static_cast<std::size_t>(first->first)]++] = first->second;
+        }
+    }
+
+    my_span<value_type> operator[](std::size_t row)
+    {
+        MY_VECTOR_HARDENED_CHECK(row < size(), "jagged_vector row out of range");
+        return my_span<value_type>(m_values.data() + m_offsets[row], m_offsets[row + 1] - m_offsets[row]);
+    }
+
+    my_span<const value_type> operator[](std::size_t row) const
+    {
+        MY_VECTOR_HARDENED_CHECK(row < size(), "jagged_vector row out of range");
+        return my_span<const value_type>(m_values.data() + m_offsets[row], m_offsets[row + 1] - m_offsets[row]);
+    }
+
+    my_span<value_type> at(std::size_t row)
+    {
+        if (row < size())
+        {
+            return (*this)[row];
+        }
+        throw my_vector_out_of_range{};
+    }
+
+    my_span<const value_type> at(std::size_t row) const
+    {
+        if (row < size())
+        {
+            return (*this)[row];
+        }
+        throw my_vector_out_of_range{};
+    }
+
+    std::size_t row_size(std::size_t row) const
+    {
+        MY_VECTOR_HARDENED_CHECK(row < size(), "jagged_vector row out of range");
+        return m_offsets[row + 1] - m_offsets[row];
+    }
+
+    iterator begin()
+    {
+        return iterator(m_values.data(), m_offsets.data());
+    }
+
+    iterator end()
+    {
+        return iterator(m_values.data(), m_offsets.data() + size());
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(m_values.data(), m_offsets.data());
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(m_values.data(), m_offsets.data() + size());
+    }
+
+    // All rows back to back.
+    const my_vector<value_type>& values() const noexcept
+    {
+        return m_values;
+    }
+
+    // size() + 1 entries, or none while there are no rows.
+    const my_vector<offset_type>& offsets() const noexcept
+    {
+        return m_offsets;
+    }
+
+    bool is_empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    // The number of rows.
+    std::size_t size() const noexcept
+    {
+        return m_offsets.is_empty() ? 0 : m_offsets.size() - 1;
+    }
+
+    std::size_t value_count() const noexcept
+    {
+        return m_values.size();
+    }
+
+    void reserve(std::size_t rowCount, std::size_t valueCount)
+    {
+        m_offsets.reserve(rowCount + 1);
+        m_values.reserve(valueCount);
+    }
+
+    template <std::input_iterator InputIt>
+    void append_row(InputIt first, InputIt last)
+    {
+        if (m_offsets.is_empty())
+        {
+            m_offsets.push_back(Offset{ 0 });
+        }
+        try
+        {
+            if constexpr (std::contiguous_iterator<InputIt> && std::is_same_v<std::iter_value_t<InputIt>, value_type>)
+            {
+                append_values(std::to_address(first), static_cast<std::size_t>(last - first));
+            }
+            else
+            {
+                m_values.insert(m_values.cend(), first, last);
+            }
+            m_offsets.push_back(checked_offset(m_values.size()));
+        }
+        catch (...)
+        {
+            m_values.resize(m_offsets.back());
+            throw;
+        }
+    }
+
+    void append_row(std::initializer_list<value_type> row)
+    {
+        append_row(row.begin(), row.end());
+    }
+
+    void append_row(my_span<const value_type> row)
+    {
+        append_row(row.begin(), row.end());
+    }
+
+    void pop_row()
+    {
+        MY_VECTOR_HARDENED_CHECK(!is_empty(), "pop_row() on an empty jagged_vector");
+        m_offsets.pop_back();
+        m_values.resize(m_offsets.back());
+        if (m_offsets.size() == 1)
+        {
+            m_offsets.clear();
+        }
+    }
+
+    void clear()
+    {
+        m_values.clear();
+        m_offsets.clear();
+    }
+
+    bool operator==(const jagged_vector& other) const
+    {
+        return m_offsets == other.m_offsets && m_values == other.m_values;
+    }
+
+private:
+    static Offset checked_offset(std::size_t offset)
+    {
+        if constexpr (std::numeric_limits<Offset>::max() < std::numeric_limits<std::size_t>::max())
+        {
+            if (offset > std::numeric_limits<Offset>::max())
+            {
+                throw my_vector_length_error{};
+            }
+        }
+        return static_cast<Offset>(offset);
+    }
+
+    // The row may be one of this vector's own, which making room for it would move, so it is
+    // copied by index once the room is there.
+    void append_values(const value_type* row, std::size_t count)
+    {
+        const value_type* const values = m_values.data();
+        if (count == 0 || std::less<>{}(row, values) || !std::less<>{}(row, values + m_values.size()))
+        {
+            m_values.insert(m_values.cend(), row, row + count);
+            return;
+        }
+        const std::size_t first = static_cast<std::size_t>(row - values);
+        m_values.reserve(m_values.size() + count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            m_values.push_back(m_values[first + i]);
+        }
+    }
+
+    my_vector<value_type> m_values;
+    my_vector<offset_type> m_offsets;
+};
+
+#endif
@@ -0,0 +1,137 @@
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#include <cstddef>
+#include <atomic>
+#include <bit>
+#include <utility>
+
+#include "my_vector.h"
+#include "cache_line.h"
+
+// Bounded multi-producer/multi-consumer queue (D. Vyukov's design). Every slot carries a
+// sequence number that tells producers and consumers whose turn it is, so a push or pop is a
+// single CAS on the shared position plus one release store on the slot. Neither call blocks.
+template <typename T>
+class mpmc_queue
+{
+    struct alignas(cache_line_size) Slot
+    {
+        Slot() = default;
+
+        Slot(Slot&& other) noexcept :
+            sequence{ other.sequence.load(std::memory_order_relaxed) },
+            value{ std::move(other.value) }
+        {
+        }
+
+        Slot& operator=(Slot&& other) noexcept
+        {
+            sequence.store(other.sequence.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            value = std::move(other.value);
+            return *this;
+        }
+
+        std::atomic<std::size_t> sequence{ 0 };
+        T value{};
+    };
+
+public:
+    using value_type = T;
+
+    // The capacity is rounded up to a power of two.
+    explicit mpmc_queue(std::size_t capacity) :
+        m_mask{ std::bit_ceil(capacity < 2 ? std::size_t{ 2 } : capacity) - 1 }
+    {
+        m_slots.reserve(m_mask + 1);
+        m_slots.resize(m_mask + 1);
+        for (std::size_t i = 0; i <= m_mask; ++i)
+        {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    mpmc_queue(const mpmc_queue&) = delete;
+    mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+    bool try_push(const value_type& elem)
+    {
+        return emplace_impl(elem);
+    }
+
+    bool try_push(value_type&& elem)
+    {
+        return emplace_impl(std::move(elem));
+    }
+
+    bool try_pop(value_type& out)
+    {
+        std::size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot& slot = m_slots[pos & m_mask];
+            const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0)
+            {
+                if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    out = std::move(slot.value);
+                    slot.sequence.store(pos + m_mask + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::size_t capacity() const noexcept
+    {
+        return m_mask + 1;
+    }
+
+private:
+    template <typename U>
+    bool emplace_impl(U&& elem)
+    {
+        std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot& slot = m_slots[pos & m_mask];
+            const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0)
+            {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    slot.value = std::forward<U>(elem);
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    my_vector<Slot, cache_line_size> m_slots;
+    std::size_t m_mask;
+
+    alignas(cache_line_size) std::atomic<std::size_t> m_enqueuePos{ 0 };
+    alignas(cache_line_size) std::atomic<std::size_t> m_dequeuePos{ 0 };
+};
+
+#endif
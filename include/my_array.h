@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <exception>
 #include <iterator>
+#include <type_traits>
 #include <algorithm>
 
 class my_array_out_of_range final : std::exception
@@ -24,10 +25,13 @@ class my_array
     public:
         using iterator_category = std::contiguous_iterator_tag;
         using difference_type = std::ptrdiff_t;
-        using value_type = U;
+        using value_type = std::remove_cv_t<U>;
+        using element_type = U;
         using pointer = U*;
         using reference = U&;
 
+        Iterator() = default;
+
         explicit Iterator(pointer ptr)
             : m_ptr(ptr)
         {
@@ -69,6 +73,11 @@ class my_array
             return Iterator(m_ptr + offset);
         }
 
+        friend Iterator operator+(difference_type offset, const Iterator& it)
+        {
+            return it + offset;
+        }
+
         Iterator& operator-=(difference_type offset)
         {
             m_ptr -= offset;
@@ -108,19 +117,23 @@ class my_array
         }
 
     private:
-        pointer m_ptr;
+        pointer m_ptr = nullptr;
     };
 
     template <typename U>
     class ReverseIterator
     {
     public:
-        using iterator_category = std::contiguous_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
         using difference_type = std::ptrdiff_t;
-        using value_type = U;
+        using value_type = std::remove_cv_t<U>;
         using pointer = U*;
         using reference = U&;
 
+        ReverseIterator() = default;
+
+        // Takes the position one past the element it refers to, like std::reverse_iterator, so
+        // rend() is the start of the buffer rather than a pointer before it.
         explicit ReverseIterator(pointer ptr) :
             m_ptr(ptr)
         {
@@ -128,12 +141,12 @@ class my_array
 
         reference operator*() const
         {
-            return *m_ptr;
+            return *(m_ptr - 1);
         }
 
         pointer operator->() const
         {
-            return m_ptr;
+            return m_ptr - 1;
         }
 
         ReverseIterator& operator++()
@@ -168,6 +181,11 @@ class my_array
             return ReverseIterator(m_ptr - offset);
         }
 
+        friend ReverseIterator operator+(difference_type offset, const ReverseIterator& it)
+        {
+            return it + offset;
+        }
+
         ReverseIterator& operator-=(difference_type offset)
         {
             m_ptr += offset;
@@ -186,7 +204,7 @@ class my_array
 
         reference operator[](difference_type index) const
         {
-            return *(m_ptr - index);
+            return *(m_ptr - 1 - index);
         }
 
         bool operator==(const ReverseIterator& other) const
@@ -196,12 +214,12 @@ class my_array
 
         auto operator<=>(const ReverseIterator& other) const
         {
-            return other <=> *this;
+            return other.m_ptr <=> m_ptr;
         }
 
         explicit operator pointer() const
         {
-            return m_ptr;
+            return m_ptr - 1;
         }
 
         operator ReverseIterator<const value_type>() const
@@ -210,7 +228,7 @@ class my_array
         }
 
     private:
-        pointer m_ptr;
+        pointer m_ptr = nullptr;
     };
 
 public:
@@ -317,12 +335,22 @@ public:
 
     reverse_iterator rbegin()
     {
-        return reverse_iterator(m_data + N - 1);
+        return reverse_iterator(m_data + N);
     }
 
     reverse_iterator rend()
     {
-        return reverse_iterator(m_data - 1);
+        return reverse_iterator(m_data);
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(m_data);
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(m_data + N);
     }
 
     const_iterator cbegin() const
@@ -337,12 +365,12 @@ public:
 
     const_reverse_iterator crbegin() const
     {
-        return const_reverse_iterator(m_data + N - 1);
+        return const_reverse_iterator(m_data + N);
     }
 
     const_reverse_iterator crend() const
     {
-        return const_reverse_iterator(m_data - 1);
+        return const_reverse_iterator(m_data);
     }
 
     template <typename U, std::size_t OtherN>
@@ -0,0 +1,30 @@
+#ifndef MY_CONTAINERS_EXTERN_H
+#define MY_CONTAINERS_EXTERN_H
+
+#include <string>
+
+#include "my_vector.h"
+
+// Element types whose my_vector specializations the my_containers library compiles once, in
+// src/my_containers.cpp. Code linked against it gets MY_CONTAINERS_EXTERN_TEMPLATES from the
+// CMake target, so my_vector.h pulls in the declarations below and the compiler stops emitting
+// its own copy of every member in every translation unit. Optimized builds may still inline
+// the members; the saving is largest in unoptimized builds, where nothing is inlined.
+#define MY_CONTAINERS_ELEMENT_TYPES(X) \
+    X(char) \
+    X(unsigned char) \
+    X(int) \
+    X(unsigned int) \
+    X(long) \
+    X(unsigned long) \
+    X(long long) \
+    X(unsigned long long) \
+    X(float) \
+    X(double) \
+    X(std::string)
+
+#define MY_CONTAINERS_EXTERN_TEMPLATE(T) extern template class my_vector<T>;
+MY_CONTAINERS_ELEMENT_TYPES(MY_CONTAINERS_EXTERN_TEMPLATE)
+#undef MY_CONTAINERS_EXTERN_TEMPLATE
+
+#endif
@@ -0,0 +1,120 @@
+#ifndef MY_MDSPAN_H
+#define MY_MDSPAN_H
+
+#include <cstddef>
+#include <type_traits>
+
+#include "my_span.h"
+#include "strided_view.h"
+
+// Row-major: element (r, c) lives at r * leading + c.
+struct layout_right
+{
+};
+
+// Column-major: element (r, c) lives at c * leading + r.
+struct layout_left
+{
+};
+
+// Non-owning 2D view. The leading dimension may exceed the logical row (or column) length, so
+// submatrix() is zero-copy. Along the contiguous direction row()/col() return a my_span, across
+// it they return a strided_view.
+template <typename T, typename Layout = layout_right>
+class my_mdspan
+{
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using layout_type = Layout;
+
+    my_mdspan() = default;
+
+    my_mdspan(T* data, std::size_t rows, std::size_t cols) :
+        my_mdspan(data, rows, cols, std::is_same_v<Layout, layout_right> ? cols : rows)
+    {
+    }
+
+    my_mdspan(T* data, std::size_t rows, std::size_t cols, std::size_t leading) :
+        m_data(data),
+        m_rows(rows),
+        m_cols(cols),
+        m_leading(leading)
+    {
+    }
+
+    template <std::size_t Extent>
+    my_mdspan(my_span<T, Extent> span, std::size_t rows, std::size_t cols) :
+        my_mdspan(span.data(), rows, cols)
+    {
+    }
+
+    T& operator()(std::size_t row, std::size_t col) const
+    {
+        if constexpr (std::is_same_v<Layout, layout_right>)
+        {
+            return m_data[row * m_leading + col];
+        }
+        else
+        {
+            return m_data[col * m_leading + row];
+        }
+    }
+
+    std::size_t rows() const noexcept
+    {
+        return m_rows;
+    }
+
+    std::size_t cols() const noexcept
+    {
+        return m_cols;
+    }
+
+    std::size_t leading_dimension() const noexcept
+    {
+        return m_leading;
+    }
+
+    T* data() const noexcept
+    {
+        return m_data;
+    }
+
+    auto row(std::size_t row) const
+    {
+        if constexpr (std::is_same_v<Layout, layout_right>)
+        {
+            return my_span<T>(m_data + row * m_leading, m_cols);
+        }
+        else
+        {
+            return strided_view<T>(m_data + row, m_cols, static_cast<std::ptrdiff_t>(m_leading));
+        }
+    }
+
+    auto col(std::size_t col) const
+    {
+        if constexpr (std::is_same_v<Layout, layout_right>)
+        {
+            return strided_view<T>(m_data + col, m_rows, static_cast<std::ptrdiff_t>(m_leading));
+        }
+        else
+        {
+            return my_span<T>(m_data + col * m_leading, m_rows);
+        }
+    }
+
+    my_mdspan submatrix(std::size_t row, std::size_t col, std::size_t rows, std::size_t cols) const
+    {
+        return my_mdspan(&(*this)(row, col), rows, cols, m_leading);
+    }
+
+private:
+    T* m_data = nullptr;
+    std::size_t m_rows = 0;
+    std::size_t m_cols = 0;
+    std::size_t m_leading = 0;
+};
+
+#endif
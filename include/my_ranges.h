@@ -0,0 +1,64 @@
+#ifndef MY_RANGES_H
+#define MY_RANGES_H
+
+#include <cstddef>
+#include <ranges>
+#include <utility>
+
+#include "default_storage.h"
+
+template <typename Container>
+struct to_container
+{
+};
+
+template <template <typename T, std::size_t = alignof(T), typename = default_storage> class Container>
+struct to_deduced_container
+{
+};
+
+// Collects a range into an explicitly named container: range | to<my_vector<float, 64>>().
+template <typename Container>
+constexpr to_container<Container> to()
+{
+    return {};
+}
+
+// Collects a range into my_vector of the range's value type: range | to<my_vector>().
+template <template <typename T, std::size_t = alignof(T), typename = default_storage> class Container>
+constexpr to_deduced_container<Container> to()
+{
+    return {};
+}
+
+// Sized sources (my_vector, my_array, transform over them, ...) are reserved for exactly once,
+// so a whole lazy pipeline materializes with a single allocation.
+template <typename Container, std::ranges::input_range Range>
+Container collect(Range&& range)
+{
+    Container result;
+    if constexpr (std::ranges::sized_range<Range>)
+    {
+        result.reserve(static_cast<std::size_t>(std::ranges::size(range)));
+    }
+    for (auto&& elem : range)
+    {
+        result.emplace_back(std::forward<decltype(elem)>(elem));
+    }
+
+    return result;
+}
+
+template <std::ranges::input_range Range, typename Container>
+Container operator|(Range&& range, to_container<Container>)
+{
+    return collect<Container>(std::forward<Range>(range));
+}
+
+template <std::ranges::input_range Range, template <typename T, std::size_t = alignof(T), typename = default_storage> class Container>
+auto operator|(Range&& range, to_deduced_container<Container>)
+{
+    return collect<Container<std::ranges::range_value_t<Range>>>(std::forward<Range>(range));
+}
+
+#endif
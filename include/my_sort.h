@@ -0,0 +1,331 @@
+#ifndef MY_SORT_H
+#define MY_SORT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "my_array.h"
+#include "my_vector.h"
+
+class my_sort_size_mismatch final : std::exception
+{
+public:
+    const char* what() const noexcept override
+    {
+        return "my_sort keys and values differ in size";
+    }
+};
+
+// Keys the radix sorts can order by their bit pattern alone.
+template <typename K>
+concept radix_key = (std::integral<K> && !std::same_as<K, bool>)
+    || (std::floating_point<K> && (sizeof(K) == 4 || sizeof(K) == 8) && std::numeric_limits<K>::is_iec559);
+
+namespace radix_detail
+{
+    inline constexpr std::size_t digit_bits = 8;
+    inline constexpr std::size_t radix = std::size_t{ 1 } << digit_bits;
+
+    // Below this many keys a comparison sort beats the fixed cost of the histograms.
+    inline constexpr std::size_t small_sort_threshold = 256;
+
+    template <typename K>
+    using bits_type = std::conditional_t<sizeof(K) == 1, std::uint8_t,
+        std::conditional_t<sizeof(K) == 2, std::uint16_t,
+        std::conditional_t<sizeof(K) == 4, std::uint32_t, std::uint64_t>>>;
+
+    // Maps a key to an unsigned integer with the same order. Negative floats have all bits
+    // flipped and positive ones just the sign bit, so -0.0 sorts before +0.0 and NaNs go to
+    // the end (or the front for negative NaNs).
+    template <radix_key K>
+    bits_type<K> to_bits(K key)
+    {
+        using Bits = bits_type<K>;
+        constexpr Bits sign = static_cast<Bits>(Bits{ 1 } << (sizeof(K) * 8 - 1));
+        const auto bits = std::bit_cast<Bits>(key);
+        if constexpr (std::floating_point<K>)
+        {
+            return static_cast<Bits>((bits & sign) != 0 ? ~bits : bits | sign);
+        }
+        else if constexpr (std::is_signed_v<K>)
+        {
+            return static_cast<Bits>(bits ^ sign);
+        }
+        else
+        {
+            return bits;
+        }
+    }
+
+    template <radix_key K>
+    std::size_t digit(K key, std::size_t shift)
+    {
+        return static_cast<std::size_t>(to_bits(key) >> shift) & (radix - 1);
+    }
+
+    struct no_values
+    {
+    };
+
+    // One stable counting pass per key byte, ping-ponging between the buffers. Bytes that are
+    // equal across all keys are skipped. Returns true when the result ended up in the scratch
+    // buffers.
+    template <typename K, typename V>
+    bool lsd_sort(K* keys, K* keyScratch, V* values, V* valueScratch, std::size_t n)
+    {
+        my_array<my_array<std::size_t, radix>, sizeof(K)> counts{};
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const auto bits = to_bits(keys[i]);
+            for (std::size_t d = 0; d < sizeof(K); ++d)
+            {
+                ++counts[d][static_cast<std::size_t>(bits >> (d * digit_bits)) & (radix - 1)];
+            }
+        }
+
+        bool inScratch = false;
+        for (std::size_t d = 0; d < sizeof(K); ++d)
+        {
+            my_array<std::size_t, radix>& offsets = counts[d];
+            if (std::find(offsets.begin(), offsets.end(), n) != offsets.end())
+            {
+                continue;
+            }
+
+            std::size_t offset = 0;
+            for (std::size_t b = 0; b < radix; ++b)
+            {
+                offset += std::exchange(offsets[b], offset);
+            }
+
+            const std::size_t shift = d * digit_bits;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const std::size_t dst = offsets[digit(keys[i], shift)]++;
+                keyScratch[dst] = keys[i];
+                if constexpr (!std::is_same_v<V, no_values>)
+                {
+                    valueScratch[dst] = std::move(values[i]);
+                }
+            }
+
+            std::swap(keys, keyScratch);
+            std::swap(values, valueScratch);
+            inScratch = !inScratch;
+        }
+
+        return inScratch;
+    }
+
+    // American flag sort: permutes each bucket into place by swapping, then recurses into the
+    // buckets on the next byte down.
+    template <typename K>
+    void msd_sort(K* keys, std::size_t n, std::size_t shift)
+    {
+        if (n <= small_sort_threshold)
+        {
+            std::sort(keys, keys + n, [](K lhs, K rhs) { return to_bits(lhs) < to_bits(rhs); });
+            return;
+        }
+
+        my_array<std::size_t, radix> counts{};
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            ++counts[digit(keys[i], shift)];
+        }
+
+        my_array<std::size_t, radix> heads{};
+        my_array<std::size_t, radix> tails{};
+        std::size_t offset = 0;
+        for (std::size_t b = 0; b < radix; ++b)
+        {
+            heads[b] = offset;
+            offset += counts[b];
+            tails[b] = offset;
+        }
+
+        for (std::size_t b = 0; b < radix; ++b)
+        {
+            while (heads[b] < tails[b])
+            {
+                K key = keys[heads[b]];
+                std::size_t d = digit(key, shift);
+                while (d != b)
+                {
+                    std::swap(key, keys[heads[d]++]);
+                    d = digit(key, shift);
+                }
+                keys[heads[b]++] = key;
+            }
+        }
+
+        if (shift == 0)
+        {
+            return;
+        }
+        for (std::size_t b = 0; b < radix; ++b)
+        {
+            msd_sort(keys + tails[b] - counts[b], counts[b], shift - digit_bits);
+        }
+    }
+}
+
+// LSD radix sort. Needs a scratch my_vector as large as the input.
+template <radix_key K, std::size_t Align, typename Storage, typename Layout>
+void radix_sort(my_vector<K, Align, Storage, Layout>& keys)
+{
+    const std::size_t n = keys.size();
+    if (n <= radix_detail::small_sort_threshold)
+    {
+        radix_detail::msd_sort(keys.data(), n, 0);
+        return;
+    }
+
+    my_vector<K, Align, Storage, Layout> scratch;
+    scratch.reserve(n);
+    scratch.resize(n);
+    radix_detail::no_values* noValues = nullptr;
+    if (radix_detail::lsd_sort(keys.data(), scratch.data(), noValues, noValues, n))
+    {
+        keys.swap(scratch);
+    }
+}
+
+// Sorts the keys and applies the same permutation to the values. Stable: values with equal
+// keys keep their relative order.
+template <radix_key K, std::size_t KeyAlign, typename KeyStorage, typename KeyLayout, typename V, std::size_t ValueAlign, typename ValueStorage, typename ValueLayout>
+void radix_sort(my_vector<K, KeyAlign, KeyStorage, KeyLayout>& keys, my_vector<V, ValueAlign, ValueStorage, ValueLayout>& values)
+{
+    const std::size_t n = keys.size();
+    if (values.size() != n)
+    {
+        throw my_sort_size_mismatch{};
+    }
+
+    my_vector<K, KeyAlign, KeyStorage, KeyLayout> keyScratch;
+    keyScratch.reserve(n);
+    keyScratch.resize(n);
+    my_vector<V, ValueAlign, ValueStorage, ValueLayout> valueScratch;
+    valueScratch.reserve(n);
+    valueScratch.resize(n);
+    if (radix_detail::lsd_sort(keys.data(), keyScratch.data(), values.data(), valueScratch.data(), n))
+    {
+        keys.swap(keyScratch);
+        values.swap(valueScratch);
+    }
+}
+
+// MSD radix sort that permutes the keys in place, for when a second buffer does not fit.
+template <radix_key K, std::size_t Align, typename Storage, typename Layout>
+void radix_sort_in_place(my_vector<K, Align, Storage, Layout>& keys)
+{
+    radix_detail::msd_sort(keys.data(), keys.size(), (sizeof(K) - 1) * radix_detail::digit_bits);
+}
+
+// Sorts one chunk per thread, then merges pairs of neighbouring runs in parallel through a
+// scratch my_vector until one run is left. Like std::sort it is not stable.
+template <std::default_initializable T, std::size_t Align, typename Storage, typename Layout, typename Compare = std::less<>>
+void parallel_merge_sort(my_vector<T, Align, Storage, Layout>& vec, Compare comp = {}, std::size_t threadsCount = std::thread::hardware_concurrency())
+{
+    constexpr std::size_t minChunk = std::size_t{ 1 } << 14;
+
+    const std::size_t n = vec.size();
+    const std::size_t chunks = std::clamp<std::size_t>(std::min(threadsCount, n / minChunk), 1, 64);
+    if (chunks == 1)
+    {
+        std::sort(vec.data(), vec.data() + n, comp);
+        return;
+    }
+
+    my_array<std::size_t, 65> bounds{};
+    for (std::size_t i = 0; i <= chunks; ++i)
+    {
+        bounds[i] = n * i / chunks;
+    }
+
+    T* src = vec.data();
+    my_vector<std::thread> threads;
+    threads.reserve(chunks);
+    for (std::size_t i = 0; i < chunks; ++i)
+    {
+        T* first = src + bounds[i];
+        T* last = src + bounds[i + 1];
+        threads.emplace_back([first, last, &comp]() { std::sort(first, last, comp); });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    my_vector<T, Align, Storage, Layout> scratch;
+    scratch.reserve(n);
+    scratch.resize(n);
+    T* dst = scratch.data();
+    bool inScratch = false;
+    for (std::size_t width = 1; width < chunks; width <<= 1)
+    {
+        threads.clear();
+        threads.reserve(chunks);
+        for (std::size_t i = 0; i < chunks; i += 2 * width)
+        {
+            const std::size_t first = bounds[i];
+            const std::size_t middle = bounds[std::min(i + width, chunks)];
+            const std::size_t last = bounds[std::min(i + 2 * width, chunks)];
+            threads.emplace_back([src, dst, first, middle, last, &comp]()
+            {
+                std::merge(std::make_move_iterator(src + first), std::make_move_iterator(src + middle),
+                    std::make_move_iterator(src + middle), std::make_move_iterator(src + last), dst + first, comp);
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        std::swap(src, dst);
+        inScratch = !inScratch;
+    }
+
+    if (inScratch)
+    {
+        vec.swap(scratch);
+    }
+}
+
+// Radix sort for radix_key elements, parallel merge sort for everything else.
+template <typename T, std::size_t Align, typename Storage, typename Layout>
+void my_sort(my_vector<T, Align, Storage, Layout>& vec)
+{
+    if constexpr (radix_key<T>)
+    {
+        radix_sort(vec);
+    }
+    else
+    {
+        parallel_merge_sort(vec);
+    }
+}
+
+template <typename T, std::size_t Align, typename Storage, typename Layout, typename Compare>
+void my_sort(my_vector<T, Align, Storage, Layout>& vec, Compare comp)
+{
+    parallel_merge_sort(vec, comp);
+}
+
+template <radix_key K, std::size_t KeyAlign, typename KeyStorage, typename KeyLayout, typename V, std::size_t ValueAlign, typename ValueStorage, typename ValueLayout>
+void my_sort(my_vector<K, KeyAlign, KeyStorage, KeyLayout>& keys, my_vector<V, ValueAlign, ValueStorage, ValueLayout>& values)
+{
+    radix_sort(keys, values);
+}
+
+#endif
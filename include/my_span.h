@@ -0,0 +1,187 @@
+#ifndef MY_SPAN_H
+#define MY_SPAN_H
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "my_array.h"
+#include "my_vector.h"
+
+inline constexpr std::size_t dynamic_extent = std::numeric_limits<std::size_t>::max();
+
+template <std::size_t Extent>
+struct span_extent
+{
+    constexpr span_extent(std::size_t)
+    {
+    }
+
+    static constexpr std::size_t size() noexcept
+    {
+        return Extent;
+    }
+};
+
+template <>
+struct span_extent<dynamic_extent>
+{
+    constexpr span_extent(std::size_t size) :
+        m_size(size)
+    {
+    }
+
+    constexpr std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    std::size_t m_size;
+};
+
+// Non-owning view of a contiguous run of T. Copying or slicing it never touches the elements.
+// A static Extent keeps the size out of the object entirely.
+template <typename T, std::size_t Extent = dynamic_extent>
+class my_span
+{
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using iterator = T*;
+
+    static constexpr std::size_t extent = Extent;
+
+    constexpr my_span() noexcept requires (Extent == 0 || Extent == dynamic_extent) :
+        m_data(nullptr),
+        m_extent(0)
+    {
+    }
+
+    // Explicit for a static Extent, as with std::span, since count then has to equal it.
+    constexpr explicit(Extent != dynamic_extent) my_span(T* data, std::size_t count) :
+        m_data(data),
+        m_extent(count)
+    {
+        MY_VECTOR_HARDENED_CHECK(Extent == dynamic_extent || count == Extent, "my_span count differs from its static extent");
+    }
+
+    template <std::size_t Align, typename Storage, typename Layout>
+    my_span(my_vector<value_type, Align, Storage, Layout>& vector) noexcept requires (Extent == dynamic_extent) :
+        m_data(vector.data()),
+        m_extent(vector.size())
+    {
+    }
+
+    template <std::size_t Align, typename Storage, typename Layout>
+    my_span(const my_vector<value_type, Align, Storage, Layout>& vector) noexcept requires (Extent == dynamic_extent && std::is_const_v<T>) :
+        m_data(vector.data()),
+        m_extent(vector.size())
+    {
+    }
+
+    template <std::size_t N>
+    my_span(my_array<value_type, N>& array) noexcept requires (Extent == dynamic_extent || Extent == N) :
+        m_data(array.data()),
+        m_extent(N)
+    {
+    }
+
+    template <std::size_t N>
+    my_span(const my_array<value_type, N>& array) noexcept requires ((Extent == dynamic_extent || Extent == N) && std::is_const_v<T>) :
+        m_data(array.data()),
+        m_extent(N)
+    {
+    }
+
+    template <typename U, std::size_t OtherExtent>
+    constexpr my_span(const my_span<U, OtherExtent>& other) noexcept
+        requires ((Extent == dynamic_extent || Extent == OtherExtent) && std::is_convertible_v<U(*)[], T(*)[]>) :
+        m_data(other.data()),
+        m_extent(other.size())
+    {
+    }
+
+    constexpr T& operator[](std::size_t i) const
+    {
+        return m_data[i];
+    }
+
+    constexpr T& front() const
+    {
+        return m_data[0];
+    }
+
+    constexpr T& back() const
+    {
+        return m_data[size() - 1];
+    }
+
+    constexpr T* data() const noexcept
+    {
+        return m_data;
+    }
+
+    constexpr std::size_t size() const noexcept
+    {
+        return m_extent.size();
+    }
+
+    constexpr std::size_t size_bytes() const noexcept
+    {
+        return size() * sizeof(T);
+    }
+
+    constexpr bool is_empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    constexpr iterator begin() const noexcept
+    {
+        return m_data;
+    }
+
+    constexpr iterator end() const noexcept
+    {
+        return m_data + size();
+    }
+
+    template <std::size_t Count>
+    constexpr my_span<T, Count> first() const
+    {
+        return my_span<T, Count>(m_data, Count);
+    }
+
+    constexpr my_span<T> first(std::size_t count) const
+    {
+        return my_span<T>(m_data, count);
+    }
+
+    constexpr my_span<T> last(std::size_t count) const
+    {
+        return my_span<T>(m_data + size() - count, count);
+    }
+
+    constexpr my_span<T> subspan(std::size_t offset, std::size_t count = dynamic_extent) const
+    {
+        return my_span<T>(m_data + offset, count == dynamic_extent ? size() - offset : count);
+    }
+
+private:
+    T* m_data;
+    [[no_unique_address]] span_extent<Extent> m_extent;
+};
+
+template <typename T, std::size_t Align, typename Storage, typename Layout>
+my_span(my_vector<T, Align, Storage, Layout>&) -> my_span<T>;
+
+template <typename T, std::size_t Align, typename Storage, typename Layout>
+my_span(const my_vector<T, Align, Storage, Layout>&) -> my_span<const T>;
+
+template <typename T, std::size_t N>
+my_span(my_array<T, N>&) -> my_span<T, N>;
+
+template <typename T, std::size_t N>
+my_span(const my_array<T, N>&) -> my_span<const T, N>;
+
+#endif
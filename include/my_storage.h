@@ -0,0 +1,28 @@
+#ifndef MY_STORAGE_H
+#define MY_STORAGE_H
+
+#include <cstddef>
+#include <cstdlib>
+
+// Storage policies hand raw buffers to my_vector. deallocate always receives the same byte
+// count and alignment that were passed to the matching allocate call.
+struct malloc_storage
+{
+    static void* allocate(std::size_t bytes, std::size_t alignment)
+    {
+        if (alignment > alignof(std::max_align_t))
+        {
+            // aligned_alloc wants the size to be a multiple of the alignment; rounding up also keeps
+            // the tail of the buffer off any cache line shared with a neighbouring allocation
+            return std::aligned_alloc(alignment, (bytes + alignment - 1) & ~(alignment - 1));
+        }
+        return std::malloc(bytes);
+    }
+
+    static void deallocate(void* ptr, std::size_t, std::size_t)
+    {
+        std::free(ptr);
+    }
+};
+
+#endif
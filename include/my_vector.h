@@ -1,14 +1,26 @@
 #ifndef MY_VECTOR_H
 #define MY_VECTOR_H
 
+#include <bit>
 #include <cstddef>
+#include <cstdlib>
 #include <cstring>
 #include <exception>
 #include <iterator>
+#include <type_traits>
+#include <memory>
 #include <utility>
 #include <algorithm>
+#include <functional>
+#include <limits>
 #include <initializer_list>
 
+#include "default_storage.h"
+#include "my_vector_layout.h"
+#include "my_vector_trace.h"
+#include "my_vector_profile.h"
+#include "my_vector_hardening.h"
+
 class my_vector_out_of_range final : std::exception
 {
 public:
@@ -18,25 +30,53 @@ public:
     }
 };
 
-template <typename T>
+class my_vector_length_error final : std::exception
+{
+public:
+    const char* what() const noexcept override
+    {
+        return "my_vector length exceeds what its layout can hold";
+    }
+};
+
+template <typename T, std::size_t Align = alignof(T), typename Storage = default_storage, typename Layout = wide_layout>
 class my_vector
 {
+    static_assert(std::has_single_bit(Align), "my_vector alignment must be a power of two");
+
+    template <typename, std::size_t, typename, typename>
+    friend class my_vector;
+
+    friend class iterator_tracking<my_vector>;
+
+    using tracking_type = iterator_tracking<my_vector>;
+
     template <typename U>
     class Iterator
     {
     public:
         using iterator_category = std::contiguous_iterator_tag;
         using difference_type = std::ptrdiff_t;
-        using value_type = U;
+        using value_type = std::remove_cv_t<U>;
+        using element_type = U;
         using pointer = U*;
         using reference = U&;
 
-        explicit Iterator(pointer ptr)
-            : m_ptr(ptr)
+        Iterator() = default;
+
+        explicit Iterator(pointer ptr, tracking_type tracking = tracking_type{})
+            : m_ptr(ptr),
+              m_tracking(tracking)
         {
         }
 
-        reference operator*() const { return *m_ptr; }
+        reference operator*() const
+        {
+            m_tracking.check_dereferenceable(m_ptr);
+            return *m_ptr;
+        }
+
+        // Unchecked: std::to_address goes through it, also for end().
         pointer operator->() const { return m_ptr; }
 
         Iterator& operator++()
@@ -47,7 +87,7 @@ class my_vector
 
         Iterator operator++(int)
         {
-            return Iterator(m_ptr++);
+            return Iterator(m_ptr++, m_tracking);
         }
 
         Iterator& operator--()
@@ -58,7 +98,7 @@ class my_vector
 
         Iterator operator--(int)
         {
-            return Iterator(m_ptr--);
+            return Iterator(m_ptr--, m_tracking);
         }
 
         Iterator& operator+=(difference_type offset)
@@ -69,7 +109,12 @@ class my_vector
 
         Iterator operator+(difference_type offset) const
         {
-            return Iterator(m_ptr + offset);
+            return Iterator(m_ptr + offset, m_tracking);
+        }
+
+        friend Iterator operator+(difference_type offset, const Iterator& it)
+        {
+            return it + offset;
         }
 
         Iterator& operator-=(difference_type offset)
@@ -80,7 +125,7 @@ class my_vector
 
         Iterator operator-(difference_type offset) const
         {
-            return Iterator(m_ptr - offset);
+            return Iterator(m_ptr - offset, m_tracking);
         }
 
         difference_type operator-(const Iterator& other) const
@@ -90,6 +135,7 @@ class my_vector
 
         reference operator[](difference_type index) const
         {
+            m_tracking.check_dereferenceable(m_ptr + index);
             return *(m_ptr + index);
         }
 
@@ -98,7 +144,10 @@ class my_vector
             return m_ptr == other.m_ptr;
         }
 
-        auto operator<=>(const Iterator& other) const = default;
+        auto operator<=>(const Iterator& other) const
+        {
+            return m_ptr <=> other.m_ptr;
+        }
 
         explicit operator pointer() const
         {
@@ -107,36 +156,43 @@ class my_vector
 
         operator Iterator<const value_type>() const
         {
-            return Iterator<const value_type>(m_ptr);
+            return Iterator<const value_type>(m_ptr, m_tracking);
         }
 
     private:
-        pointer m_ptr;
+        pointer m_ptr = nullptr;
+        [[no_unique_address]] tracking_type m_tracking;
     };
 
     template <typename U>
     class ReverseIterator
     {
     public:
-        using iterator_category = std::contiguous_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
         using difference_type = std::ptrdiff_t;
-        using value_type = U;
+        using value_type = std::remove_cv_t<U>;
         using pointer = U*;
         using reference = U&;
 
-        explicit ReverseIterator(pointer ptr)
-            : m_ptr(ptr)
+        ReverseIterator() = default;
+
+        // Takes the position one past the element it refers to, like std::reverse_iterator, so
+        // rend() is the start of the buffer rather than a pointer before it.
+        explicit ReverseIterator(pointer ptr, tracking_type tracking = tracking_type{})
+            : m_ptr(ptr),
+              m_tracking(tracking)
         {
         }
 
         reference operator*() const
         {
-            return *m_ptr;
+            m_tracking.check_dereferenceable(m_ptr - 1);
+            return *(m_ptr - 1);
         }
 
         pointer operator->() const
         {
-            return m_ptr;
+            return m_ptr - 1;
         }
 
         ReverseIterator& operator++()
@@ -147,7 +203,7 @@ class my_vector
 
         ReverseIterator operator++(int)
         {
-            return ReverseIterator(m_ptr--);
+            return ReverseIterator(m_ptr--, m_tracking);
         }
 
         ReverseIterator& operator--() {
@@ -157,7 +213,7 @@ class my_vector
 
         ReverseIterator operator--(int)
         {
-            return ReverseIterator(m_ptr++);
+            return ReverseIterator(m_ptr++, m_tracking);
         }
 
         ReverseIterator& operator+=(difference_type offset)
@@ -168,7 +224,12 @@ class my_vector
 
         ReverseIterator operator+(difference_type offset) const
         {
-            return ReverseIterator(m_ptr - offset);
+            return ReverseIterator(m_ptr - offset, m_tracking);
+        }
+
+        friend ReverseIterator operator+(difference_type offset, const ReverseIterator& it)
+        {
+            return it + offset;
         }
 
         ReverseIterator& operator-=(difference_type offset)
@@ -179,7 +240,7 @@ class my_vector
 
         ReverseIterator operator-(difference_type offset) const
         {
-            return ReverseIterator(m_ptr + offset);
+            return ReverseIterator(m_ptr + offset, m_tracking);
         }
 
         difference_type operator-(const ReverseIterator& other) const
@@ -189,7 +250,8 @@ class my_vector
 
         reference operator[](difference_type index) const
         {
-            return *(m_ptr - index);
+            m_tracking.check_dereferenceable(m_ptr - 1 - index);
+            return *(m_ptr - 1 - index);
         }
 
         bool operator==(const ReverseIterator& other) const
@@ -199,69 +261,104 @@ class my_vector
 
         auto operator<=>(const ReverseIterator& other) const
         {
-            return other <=> *this;
+            return other.m_ptr <=> m_ptr;
         }
 
         explicit operator pointer() const
         {
-            return m_ptr;
+            return m_ptr - 1;
         }
 
         operator ReverseIterator<const value_type>() const
         {
-            return ReverseIterator<const value_type>(m_ptr);
+            return ReverseIterator<const value_type>(m_ptr, m_tracking);
         }
 
     private:
-        pointer m_ptr;
+        pointer m_ptr = nullptr;
+        [[no_unique_address]] tracking_type m_tracking;
     };
 
 public:
     using value_type = T;
+    using storage_type = Storage;
+    using layout_type = Layout;
 
+    static constexpr std::size_t alignment = std::max(Align, alignof(T));
+
+private:
+    using layout_state = typename Layout::template state<T, alignment>;
+
+    static constexpr bool capacity_is_limited =
+        layout_state::max_capacity < std::numeric_limits<std::size_t>::max() / sizeof(value_type);
+
+public:
     using iterator = Iterator<value_type>;
     using const_iterator = Iterator<const value_type>;
     using reverse_iterator = ReverseIterator<value_type>;
     using const_reverse_iterator = ReverseIterator<const value_type>;
 
+#ifdef MY_VECTOR_PROFILE
+    my_vector(vector_profile_location callSite = {})
+    {
+        const std::source_location profileLocation = callSite.location;
+        MY_VECTOR_PROFILE_ATTACH();
+    }
+#else
     my_vector() = default;
+#endif
 
-    my_vector(const my_vector& other)
+    my_vector(const my_vector& other MY_VECTOR_PROFILE_LOCATION_ARG)
     {
+        MY_VECTOR_PROFILE_ATTACH();
         insert(end(), other.cbegin(), other.cend());
     }
 
-    my_vector(my_vector&& other) noexcept :
-        m_capacity{ other.m_capacity },
-        m_size{ other.m_size },
-        m_data{ other.m_data }
+    my_vector(my_vector&& other MY_VECTOR_PROFILE_LOCATION_ARG) noexcept :
+        m_layout{ std::exchange(other.m_layout, layout_state{}) }
     {
-        other.m_capacity = 0;
-        other.m_size = 0;
-        other.m_data = nullptr;
+        MY_VECTOR_PROFILE_ATTACH();
+#ifdef MY_VECTOR_HARDENED
+        swap_trackers(other);
+#endif
     }
 
-    my_vector(std::initializer_list<value_type> initializerList)
+    my_vector(std::initializer_list<value_type> initializerList MY_VECTOR_PROFILE_LOCATION_ARG)
     {
+        MY_VECTOR_PROFILE_ATTACH();
         insert(end(), initializerList.begin(), initializerList.end());
     }
 
-    template<class InputIt>
-    my_vector(InputIt first, InputIt last)
+    template<std::input_iterator InputIt>
+    my_vector(InputIt first, InputIt last MY_VECTOR_PROFILE_LOCATION_ARG)
     {
+        MY_VECTOR_PROFILE_ATTACH();
         insert(end(), first, last);
     }
 
-    my_vector(std::size_t n, const T& elem)
+    my_vector(std::size_t n, const T& elem MY_VECTOR_PROFILE_LOCATION_ARG)
     {
+        MY_VECTOR_PROFILE_ATTACH();
         resize(n, elem);
     }
 
+    ~my_vector()
+    {
+        for (std::size_t i = 0; i < size(); ++i)
+        {
+            data()[i].~value_type();
+        }
+        deallocate(data(), capacity());
+#ifdef MY_VECTOR_HARDENED
+        m_tracker->owner = nullptr;
+#endif
+    }
+
     my_vector& operator=(const my_vector& other)
     {
         if (this != &other)
         {
-            my_vector tmp(other);
+            my_vector tmp(other MY_VECTOR_PROFILE_SAME_SITE);
             swap(tmp);
         }
 
@@ -272,7 +369,7 @@ public:
     {
         if (this != &other)
         {
-            my_vector tmp(std::move(other));
+            my_vector tmp(std::move(other) MY_VECTOR_PROFILE_SAME_SITE);
             swap(tmp);
         }
 
@@ -281,7 +378,7 @@ public:
 
     my_vector& operator=(std::initializer_list<value_type> initializerList)
     {
-        my_vector tmp(std::move(initializerList));
+        my_vector tmp(std::move(initializerList) MY_VECTOR_PROFILE_SAME_SITE);
         swap(tmp);
 
         return *this;
@@ -291,7 +388,7 @@ public:
     {
         if (i < size())
         {
-            return m_data[i];
+            return data()[i];
         }
         throw my_vector_out_of_range{};
     }
@@ -300,115 +397,142 @@ public:
     {
         if (i < size())
         {
-            return m_data[i];
+            return data()[i];
         }
         throw my_vector_out_of_range{};
     }
 
     value_type& operator[](std::size_t i)
     {
-        return m_data[i];
+        MY_VECTOR_HARDENED_CHECK(i < size(), "operator[] index out of range");
+        return data()[i];
     }
 
     const value_type& operator[](std::size_t i) const
     {
-        return m_data[i];
+        MY_VECTOR_HARDENED_CHECK(i < size(), "operator[] index out of range");
+        return data()[i];
     }
 
     value_type& front()
     {
-        return m_data[0];
+        MY_VECTOR_HARDENED_CHECK(size() != 0, "front() on an empty my_vector");
+        return data()[0];
     }
 
     const value_type& front() const
     {
-        return m_data[0];
+        MY_VECTOR_HARDENED_CHECK(size() != 0, "front() on an empty my_vector");
+        return data()[0];
     }
 
     value_type& back()
     {
-        return m_data[size() - 1];
+        MY_VECTOR_HARDENED_CHECK(size() != 0, "back() on an empty my_vector");
+        return data()[size() - 1];
     }
 
     const value_type& back() const
     {
-        return m_data[size() - 1];
+        MY_VECTOR_HARDENED_CHECK(size() != 0, "back() on an empty my_vector");
+        return data()[size() - 1];
     }
 
     value_type* data() noexcept
     {
-        return m_data;
+        return m_layout.data();
     }
 
     const value_type* data() const noexcept
     {
-        return m_data;
+        return m_layout.data();
+    }
+
+    value_type* aligned_data() noexcept
+    {
+        return std::assume_aligned<alignment>(data());
+    }
+
+    const value_type* aligned_data() const noexcept
+    {
+        return std::assume_aligned<alignment>(data());
     }
 
     bool is_empty() const noexcept
     {
-        return m_size == 0;
+        return size() == 0;
     }
 
     std::size_t size() const noexcept
     {
-        return m_size;
+        return m_layout.size();
     }
 
     std::size_t capacity() const noexcept
     {
-        return m_capacity;
+        return m_layout.capacity();
     }
 
     void swap(my_vector& other) noexcept
     {
-        std::swap(m_capacity, other.m_capacity);
-        std::swap(m_size, other.m_size);
-        std::swap(m_data, other.m_data);
+        std::swap(m_layout, other.m_layout);
+#ifdef MY_VECTOR_HARDENED
+        swap_trackers(other);
+#endif
     }
 
     iterator begin()
     {
-        return iterator(m_data);
+        return iterator(data(), tracking());
     }
 
     iterator end()
     {
-        return iterator(m_data + size());
+        return iterator(data() + size(), tracking());
     }
 
     reverse_iterator rbegin()
     {
-        return reverse_iterator(m_data + size() - 1);
+        return reverse_iterator(data() + size(), tracking());
     }
 
     reverse_iterator rend()
     {
-        return reverse_iterator(m_data - 1);
+        return reverse_iterator(data(), tracking());
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(data(), tracking());
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(data() + size(), tracking());
     }
 
     const_iterator cbegin() const
     {
-        return const_iterator(m_data);
+        return const_iterator(data(), tracking());
     }
 
     const_iterator cend() const
     {
-        return const_iterator(m_data + size());
+        return const_iterator(data() + size(), tracking());
     }
 
     const_reverse_iterator crbegin() const
     {
-        return const_reverse_iterator(m_data + size() - 1);
+        return const_reverse_iterator(data() + size(), tracking());
     }
 
     const_reverse_iterator crend() const
     {
-        return const_reverse_iterator(m_data - 1);
+        return const_reverse_iterator(data(), tracking());
     }
 
-    template <typename U>
-    bool operator==(const my_vector<U>& other) const noexcept
+    template <typename U, std::size_t OtherAlign, typename OtherStorage, typename OtherLayout>
+    bool operator==(const my_vector<U, OtherAlign, OtherStorage, OtherLayout>& other) const noexcept
     {
         if (size() != other.size())
         {
@@ -417,7 +541,7 @@ public:
 
         for (std::size_t i = 0; i < size(); ++i)
         {
-            if (m_data[i] != other.m_data[i])
+            if (data()[i] != other.data()[i])
             {
                 return false;
             }
@@ -426,15 +550,15 @@ public:
         return true;
     }
 
-    template <typename U>
-    auto operator<=>(const my_vector<U>& other) const
+    template <typename U, std::size_t OtherAlign, typename OtherStorage, typename OtherLayout>
+    auto operator<=>(const my_vector<U, OtherAlign, OtherStorage, OtherLayout>& other) const
     {
         return std::lexicographical_compare_three_way(cbegin(), cend(), other.cbegin(), other.cend());
     }
 
     void reserve(std::size_t newCapacity)
     {
-        if (m_capacity < newCapacity)
+        if (capacity() < newCapacity)
         {
             reallocate(newCapacity);
         }
@@ -442,213 +566,179 @@ public:
 
     void shrink_to_fit()
     {
-        reallocate(m_size);
+        MY_VECTOR_TRACE_SCOPE(shrink_to_fit, size(), (capacity() - size()) * sizeof(value_type));
+        reallocate(size());
     }
 
     void push_back(const value_type& elem)
     {
-        if (m_size == m_capacity)
-        {
-            value_type elemCopy = elem;
-            if (m_capacity != 0)
-            {
-                reallocate(m_capacity << 1);
-            }
-            else
-            {
-                reallocate(1);
-            }
-
-            new(m_data + m_size++) value_type(std::move(elemCopy));
-        }
-        else
-        {
-            new(m_data + m_size++) value_type(elem);
-        }
+        emplace_back(elem);
     }
 
     void push_back(value_type&& elem)
     {
-        if (m_size == m_capacity)
-        {
-            value_type elemCopy = elem;
-            if (m_capacity != 0)
-            {
-                reallocate(m_capacity << 1);
-            }
-            else
-            {
-                reallocate(1);
-            }
-
-            new(m_data + m_size++) value_type(std::move(elem));
-        }
-        else
-        {
-            new(m_data + m_size++) value_type(elem);
-        }
+        emplace_back(std::move(elem));
     }
 
     template<class... Args>
     void emplace_back(Args&&... args)
     {
-        if (m_size == m_capacity)
+        if (size() == capacity())
         {
-            if (m_capacity != 0)
-            {
-                reallocate(m_capacity << 1);
-            }
-            else
-            {
-                reallocate(1);
-            }
+            grow_and_emplace_back(std::forward<Args>(args)...);
         }
-
-        new(m_data + m_size++) value_type(std::forward<Args>(args)...);
+        else
+        {
+            new(data() + size()) value_type(std::forward<Args>(args)...);
+        }
+        m_layout.set_size(size() + 1);
     }
 
     void pop_back()
     {
-        m_data[--m_size].~value_type();
-        while (m_capacity != 0 && m_size == m_capacity >> 2)
+        MY_VECTOR_HARDENED_CHECK(size() != 0, "pop_back() on an empty my_vector");
+        m_layout.set_size(size() - 1);
+        data()[size()].~value_type();
+        while (capacity() != 0 && size() == capacity() >> 2)
         {
-            reallocate(m_capacity >> 1);
+            reallocate(capacity() >> 1);
         }
     }
 
     iterator insert(const_iterator pos, value_type&& elem)
     {
         std::size_t numPos = pos - cbegin();
+        MY_VECTOR_HARDENED_CHECK(numPos <= size(), "insert position outside the my_vector");
 
-        if (m_size == m_capacity)
+        if (size() == capacity())
         {
-            if (m_capacity != 0)
-            {
-                reallocate(m_capacity << 1);
-            }
-            else
-            {
-                reallocate(1);
-            }
+            reallocate(grown_capacity(size() + 1));
         }
 
-        ++m_size;
-        for (int i = m_size - 1; i > numPos; --i)
+        m_layout.set_size(size() + 1);
+        for (std::size_t i = size() - 1; i > numPos; --i)
         {
-            if (i == m_size - 1)
+            if (i == size() - 1)
             {
-                new(m_data + i) value_type(std::forward<value_type>(m_data[i - 1]));
+                new(data() + i) value_type(std::forward<value_type>(data()[i - 1]));
             }
             else
             {
-                m_data[i] = std::move(m_data[i - 1]);
+                data()[i] = std::move(data()[i - 1]);
             }
         }
 
-        if (numPos == m_size - 1)
+        if (numPos == size() - 1)
         {
-            new(m_data + numPos) value_type(std::forward<value_type>(elem));
+            new(data() + numPos) value_type(std::forward<value_type>(elem));
         }
         else
         {
-            m_data[numPos] = std::forward<value_type>(elem);
+            data()[numPos] = std::forward<value_type>(elem);
         }
 
-        return iterator(m_data + numPos);
+        return iterator(data() + numPos, tracking());
     }
 
-    template <typename InputIt>
+    template <std::input_iterator InputIt>
     iterator insert(const_iterator pos, InputIt first, InputIt last)
     {
         std::size_t numPos = pos - cbegin();
-        const std::size_t elemsCount = std::distance(first, last);
-
-        while (m_size + elemsCount > m_capacity)
+        MY_VECTOR_HARDENED_CHECK(numPos <= size(), "insert position outside the my_vector");
+        if constexpr (!std::forward_iterator<InputIt>)
         {
-            if (m_capacity != 0)
-            {
-                reallocate(m_capacity << 1);
-            }
-            else
+            // A single pass cannot be counted first: append the elements, then rotate them into place.
+            const std::size_t oldSize = size();
+            for (; first != last; ++first)
             {
-                reallocate(1);
+                emplace_back(*first);
             }
+            std::rotate(data() + numPos, data() + oldSize, data() + size());
+            return iterator(data() + numPos, tracking());
         }
+        const std::size_t elemsCount = std::distance(first, last);
+        MY_VECTOR_TRACE_SCOPE(insert, elemsCount, (size() - numPos) * sizeof(value_type));
 
-        m_size += elemsCount;
-        for (int i = m_size - 1; i >= numPos + elemsCount; --i)
+        if (size() + elemsCount > capacity())
         {
-            if (i >= m_size - elemsCount)
+            reallocate(grown_capacity(size() + elemsCount));
+        }
+
+        m_layout.set_size(size() + elemsCount);
+        for (std::size_t i = size(); i > numPos + elemsCount; --i)
+        {
+            if (i - 1 >= size() - elemsCount)
             {
-                new(m_data + i) value_type(std::forward<value_type>(m_data[i - elemsCount]));
+                new(data() + i - 1) value_type(std::move(data()[i - 1 - elemsCount]));
             }
             else
             {
-                m_data[i] = std::move(m_data[i - elemsCount]);
+                data()[i - 1] = std::move(data()[i - 1 - elemsCount]);
             }
         }
 
         std::size_t currPos = numPos;
         while (first != last)
         {
-            if (currPos >= m_size - elemsCount)
+            if (currPos >= size() - elemsCount)
             {
-                new(m_data + currPos++) value_type(*first++);
+                new(data() + currPos++) value_type(*first++);
             }
             else
             {
-                m_data[currPos++] = *first++;
+                data()[currPos++] = *first++;
             }
         }
 
-        return iterator(m_data + numPos);
+        return iterator(data() + numPos, tracking());
     }
 
     iterator erase(const_iterator pos)
     {
         std::size_t numPos = pos - cbegin();
+        MY_VECTOR_HARDENED_CHECK(numPos < size(), "erase position outside the my_vector");
+        MY_VECTOR_TRACE_SCOPE(erase, 1, (size() - numPos - 1) * sizeof(value_type));
 
-        m_data[numPos].~value_type();
-
-        --m_size;
-        for (std::size_t i = numPos; i < m_size; ++i)
+        m_layout.set_size(size() - 1);
+        for (std::size_t i = numPos; i < size(); ++i)
         {
-            m_data[i] = std::move(m_data[i + 1]);
+            data()[i] = std::move(data()[i + 1]);
         }
+        data()[size()].~value_type();
 
-        while (m_capacity != 0 && m_size == m_capacity >> 2)
+        while (capacity() != 0 && size() == capacity() >> 2)
         {
-            reallocate(m_capacity >> 1);
+            reallocate(capacity() >> 1);
         }
 
-        return iterator(m_data + numPos);
+        return iterator(data() + numPos, tracking());
     }
 
     iterator erase(iterator first, iterator last)
     {
         std::size_t intervalSize = last - first;
         std::size_t numPos = first - begin();
+        MY_VECTOR_HARDENED_CHECK(first <= last && numPos <= size() && intervalSize <= size() - numPos,
+            "erase range outside the my_vector");
+        MY_VECTOR_TRACE_SCOPE(erase, intervalSize, (size() - numPos - intervalSize) * sizeof(value_type));
 
-        const_iterator endRange = last;
-        while (first != end() - intervalSize)
+        for (std::size_t i = numPos; i + intervalSize < size(); ++i)
         {
-            first->~value_type();
-            if (last != end())
-            {
-                *first = *last;
-                ++last;
-            }
-            ++first;
+            data()[i] = std::move(data()[i + intervalSize]);
+        }
+        for (std::size_t i = size() - intervalSize; i < size(); ++i)
+        {
+            data()[i].~value_type();
         }
 
-        m_size -= intervalSize;
+        m_layout.set_size(size() - intervalSize);
 
-        while (m_capacity != 0 && m_size <= m_capacity >> 2)
+        while (capacity() != 0 && size() <= capacity() >> 2)
         {
-            reallocate(m_capacity >> 1);
+            reallocate(capacity() >> 1);
         }
 
-        return iterator(m_data + numPos);
+        return iterator(data() + numPos, tracking());
     }
 
     void clear()
@@ -659,28 +749,21 @@ public:
 
     void resize(std::size_t count)
     {
-        if (count < m_size)
+        if (count < size())
         {
             erase(begin() + count, end());
         }
         else
         {
-            while (count > m_capacity)
+            if (count > capacity())
             {
-                if (m_capacity != 0)
-                {
-                    reallocate(m_capacity << 1);
-                }
-                else
-                {
-                    reallocate(1);
-                }
+                reallocate(grown_capacity(count));
             }
-            for (std::size_t i = m_size; i < count; ++i)
+            for (std::size_t i = size(); i < count; ++i)
             {
-                new(m_data + i) value_type{};
+                new(data() + i) value_type{};
             }
-            m_size = count;
+            m_layout.set_size(count);
         }
     }
 
@@ -690,43 +773,165 @@ public:
         {
             erase(begin() + count, end());
         }
-        else
+        else if (count > capacity())
         {
-            while (count > m_capacity)
+            // value may be one of our elements, which the reallocation is about to move
+            const value_type valueCopy = value;
+            reallocate(grown_capacity(count));
+            for (std::size_t i = size(); i < count; ++i)
             {
-                if (m_capacity != 0)
-                {
-                    reallocate(m_capacity << 1);
-                }
-                else
-                {
-                    reallocate(1);
-                }
+                new(data() + i) value_type(valueCopy);
             }
-            for (std::size_t i = m_size; i < count; ++i)
+            m_layout.set_size(count);
+        }
+        else
+        {
+            for (std::size_t i = size(); i < count; ++i)
             {
-                new(m_data + i) value_type(value);
+                new(data() + i) value_type(value);
             }
-            m_size = count;
+            m_layout.set_size(count);
         }
     }
 
 private:
     void reallocate(std::size_t newCapacity)
     {
-        m_capacity = newCapacity;
-        auto newBuffer = static_cast<value_type*>(std::malloc(sizeof(value_type) * newCapacity));
-        for (std::size_t i = 0; i < std::min(size(), capacity()); ++i)
+        MY_VECTOR_TRACE_SCOPE(reallocate, size(), newCapacity * sizeof(value_type));
+        MY_VECTOR_PROFILE_REALLOCATION();
+        relocate_to(allocate(newCapacity), newCapacity);
+    }
+
+    // Builds the new last element in the new buffer before the old elements move out, so
+    // arguments that refer to one of them (v.push_back(v[0])) are still valid when used.
+    template<class... Args>
+    void grow_and_emplace_back(Args&&... args)
+    {
+        const std::size_t newCapacity = grown_capacity(size() + 1);
+        MY_VECTOR_TRACE_SCOPE(reallocate, size(), newCapacity * sizeof(value_type));
+        MY_VECTOR_PROFILE_REALLOCATION();
+        auto newBuffer = allocate(newCapacity);
+        try
+        {
+            new(newBuffer + size()) value_type(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            deallocate(newBuffer, newCapacity);
+            throw;
+        }
+        relocate_to(newBuffer, newCapacity);
+    }
+
+    void relocate_to(value_type* newBuffer, std::size_t newCapacity)
+    {
+        // Read before the old buffer goes, which is where thin_layout keeps them.
+        const std::size_t oldSize = size();
+        const std::size_t oldCapacity = capacity();
+        for (std::size_t i = 0; i < std::min(oldSize, newCapacity); ++i)
+        {
+            new(newBuffer + i) value_type(std::move(data()[i]));
+            data()[i].~value_type();
+        }
+        deallocate(data(), oldCapacity);
+        m_layout.assign(newBuffer, oldSize, newCapacity);
+        invalidate_iterators();
+    }
+
+    void invalidate_iterators() noexcept
+    {
+#ifdef MY_VECTOR_HARDENED
+        ++m_tracker->generation;
+#endif
+    }
+
+    tracking_type tracking() const noexcept
+    {
+#ifdef MY_VECTOR_HARDENED
+        return tracking_type(m_tracker);
+#else
+        return tracking_type{};
+#endif
+    }
+
+#ifdef MY_VECTOR_HARDENED
+    // The trackers go with the buffers, so iterators into each buffer stay valid.
+    void swap_trackers(my_vector& other) noexcept
+    {
+        std::swap(m_tracker, other.m_tracker);
+        m_tracker->owner = this;
+        other.m_tracker->owner = &other;
+    }
+
+    bool owns_element(const void* ptr) const noexcept
+    {
+        const auto* elem = static_cast<const value_type*>(ptr);
+        return std::less_equal<>{}(data(), elem) && std::less<>{}(elem, data() + size());
+    }
+#endif
+
+    // Doubling from the current capacity, as repeated push_backs would, but in one step.
+    std::size_t grown_capacity(std::size_t minCapacity) const noexcept
+    {
+        std::size_t newCapacity = capacity() != 0 ? capacity() : 1;
+        while (newCapacity < minCapacity)
         {
-            newBuffer[i] = std::move(m_data[i]);
+            newCapacity <<= 1;
         }
-        free(m_data);
-        m_data = newBuffer;
+        if constexpr (capacity_is_limited)
+        {
+            if (newCapacity > layout_state::max_capacity && minCapacity <= layout_state::max_capacity)
+            {
+                newCapacity = layout_state::max_capacity;
+            }
+        }
+        return newCapacity;
+    }
+
+    static value_type* allocate(std::size_t count)
+    {
+        if constexpr (capacity_is_limited)
+        {
+            if (count > layout_state::max_capacity)
+            {
+                throw my_vector_length_error{};
+            }
+        }
+        return layout_state::template allocate<storage_type>(count);
+    }
+
+    static void deallocate(value_type* buffer, std::size_t count)
+    {
+        layout_state::template deallocate<storage_type>(buffer, count);
     }
 
-    std::size_t m_capacity = 0;
-    std::size_t m_size = 0;
-    value_type* m_data = nullptr;
+#ifdef MY_VECTOR_PROFILE
+    static vector_profile_usage profile_usage(const void* owner)
+    {
+        const auto* self = static_cast<const my_vector*>(owner);
+        return { self->size() * sizeof(value_type), self->capacity() * sizeof(value_type) };
+    }
+#endif
+
+    layout_state m_layout;
+#ifdef MY_VECTOR_PROFILE
+    vector_profile_hook m_profile;
+#endif
+#ifdef MY_VECTOR_HARDENED
+    // Every vector has one, even without a buffer, so the move constructor allocates.
+    std::shared_ptr<hardening_detail::buffer_tracker<my_vector>> m_tracker = std::make_shared<hardening_detail::buffer_tracker<my_vector>>(this);
+#endif
 };
 
+// my_vector in 16 and 8 bytes, see my_vector_layout.h.
+template <typename T, std::size_t Align = alignof(T), typename Storage = default_storage>
+using compact_vector = my_vector<T, Align, Storage, compact_layout>;
+
+template <typename T, std::size_t Align = alignof(T), typename Storage = default_storage>
+using thin_vector = my_vector<T, Align, Storage, thin_layout>;
+
+#ifdef MY_CONTAINERS_EXTERN_TEMPLATES
+#include "my_containers_extern.h"
+#endif
+
 #endif
@@ -0,0 +1,107 @@
+#ifndef MY_VECTOR_HARDENING_H
+#define MY_VECTOR_HARDENING_H
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <atomic>
+#include <memory>
+#include <utility>
+
+// Hardened mode of my_vector, selected at compile time with MY_VECTOR_HARDENED. operator[],
+// front, back, pop_back, insert and erase check their arguments, and iterators remember their
+// buffer and its generation, which every reallocation bumps, so dereferencing one that a
+// reallocation invalidated is caught too. A failed check calls the violation handler, which
+// prints the message and aborts unless replaced. Without the macro the checks expand to
+// nothing, iterators are a bare pointer and my_vector has no extra member; codegen/ verifies
+// that the generated code is identical to raw pointer access.
+
+using my_vector_violation_handler = void (*)(const char* message);
+
+namespace hardening_detail
+{
+    inline void default_violation_handler(const char* message)
+    {
+        std::fprintf(stderr, "my_vector hardening: %s\n", message);
+        std::abort();
+    }
+
+    inline std::atomic<my_vector_violation_handler> handler{ default_violation_handler };
+}
+
+// Replaces the handler and returns the previous one. A handler may throw to unwind out of the
+// failed call, e.g. in tests; if it returns, the program aborts.
+inline my_vector_violation_handler set_my_vector_violation_handler(my_vector_violation_handler handler) noexcept
+{
+    return hardening_detail::handler.exchange(handler != nullptr ? handler : hardening_detail::default_violation_handler);
+}
+
+[[gnu::cold, gnu::noinline]] inline void my_vector_violation(const char* message)
+{
+    hardening_detail::handler.load(std::memory_order_relaxed)(message);
+    std::abort();
+}
+
+#ifdef MY_VECTOR_HARDENED
+#define MY_VECTOR_HARDENED_CHECK(condition, message) \
+    (__builtin_expect(!(condition), 0) ? my_vector_violation(message) : (void)0)
+#else
+#define MY_VECTOR_HARDENED_CHECK(condition, message) ((void)0)
+#endif
+
+// What an iterator remembers about the buffer it points into. The buffer_tracker belongs to
+// the buffer rather than to the vector: swap and move hand it on with the buffer, so iterators
+// stay valid and follow their elements into the other vector. The vector bumps its generation
+// when it reallocates and clears its owner when it lets go of the buffer for good. Iterators
+// built from a bare pointer, like devector's, are not tracked.
+#ifdef MY_VECTOR_HARDENED
+namespace hardening_detail
+{
+    template <typename Vector>
+    struct buffer_tracker
+    {
+        const Vector* owner;
+        std::size_t generation = 0;
+    };
+}
+
+template <typename Vector>
+class iterator_tracking
+{
+public:
+    iterator_tracking() = default;
+
+    explicit iterator_tracking(std::shared_ptr<const hardening_detail::buffer_tracker<Vector>> tracker) noexcept :
+        m_tracker(std::move(tracker)),
+        m_generation(m_tracker->generation)
+    {
+    }
+
+    void check_dereferenceable(const void* ptr) const
+    {
+        if (m_tracker != nullptr)
+        {
+            MY_VECTOR_HARDENED_CHECK(m_tracker->owner != nullptr, "iterator used after its my_vector released the buffer");
+            MY_VECTOR_HARDENED_CHECK(m_generation == m_tracker->generation, "iterator used after its my_vector reallocated");
+            MY_VECTOR_HARDENED_CHECK(m_tracker->owner->owns_element(ptr), "iterator dereferenced outside its my_vector");
+        }
+    }
+
+private:
+    std::shared_ptr<const hardening_detail::buffer_tracker<Vector>> m_tracker;
+    std::size_t m_generation = 0;
+};
+#else
+template <typename Vector>
+class iterator_tracking
+{
+public:
+    iterator_tracking() = default;
+
+    void check_dereferenceable(const void*) const noexcept
+    {
+    }
+};
+#endif
+
+#endif
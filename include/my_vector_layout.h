@@ -0,0 +1,217 @@
+#ifndef MY_VECTOR_LAYOUT_H
+#define MY_VECTOR_LAYOUT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <algorithm>
+
+// Layout policies decide where my_vector keeps its buffer pointer, size and capacity. Each has
+// a nested state<T, Alignment>, which is my_vector's only data member, and whose static
+// allocate and deallocate turn an element count into a request to the storage policy.
+//
+//     wide_layout      pointer, size and capacity as three words (24 bytes on 64-bit)
+//     compact_layout   32-bit size and capacity next to the pointer (16 bytes), at most
+//                      2^32 - 1 elements
+//     thin_layout      only the pointer (8 bytes); 32-bit size and capacity live in a header in
+//                      front of the elements, and an empty vector holds nullptr
+//
+// The smaller layouts are for vectors that are members of objects there are millions of, such
+// as adjacency lists. thin_layout wins when most of them are empty: size() has to check for
+// nullptr and then read the heap block, which costs a cache miss when scanning many vectors.
+
+struct wide_layout
+{
+    template <typename T, std::size_t Alignment>
+    class state
+    {
+    public:
+        static constexpr std::size_t max_capacity = std::numeric_limits<std::size_t>::max() / sizeof(T);
+
+        T* data() const noexcept
+        {
+            return m_data;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return m_capacity;
+        }
+
+        void set_size(std::size_t size) noexcept
+        {
+            m_size = size;
+        }
+
+        void assign(T* data, std::size_t size, std::size_t capacity) noexcept
+        {
+            m_capacity = capacity;
+            m_size = size;
+            m_data = data;
+        }
+
+        template <typename Storage>
+        static T* allocate(std::size_t capacity)
+        {
+            return static_cast<T*>(Storage::allocate(sizeof(T) * capacity, Alignment));
+        }
+
+        template <typename Storage>
+        static void deallocate(T* buffer, std::size_t capacity)
+        {
+            Storage::deallocate(buffer, sizeof(T) * capacity, Alignment);
+        }
+
+    private:
+        std::size_t m_capacity = 0;
+        std::size_t m_size = 0;
+        T* m_data = nullptr;
+    };
+};
+
+struct compact_layout
+{
+    template <typename T, std::size_t Alignment>
+    class state
+    {
+    public:
+        static constexpr std::size_t max_capacity =
+            std::min<std::size_t>(std::numeric_limits<std::uint32_t>::max(), std::numeric_limits<std::size_t>::max() / sizeof(T));
+
+        T* data() const noexcept
+        {
+            return m_data;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return m_capacity;
+        }
+
+        void set_size(std::size_t size) noexcept
+        {
+            m_size = static_cast<std::uint32_t>(size);
+        }
+
+        void assign(T* data, std::size_t size, std::size_t capacity) noexcept
+        {
+            m_data = data;
+            m_size = static_cast<std::uint32_t>(size);
+            m_capacity = static_cast<std::uint32_t>(capacity);
+        }
+
+        template <typename Storage>
+        static T* allocate(std::size_t capacity)
+        {
+            return static_cast<T*>(Storage::allocate(sizeof(T) * capacity, Alignment));
+        }
+
+        template <typename Storage>
+        static void deallocate(T* buffer, std::size_t capacity)
+        {
+            Storage::deallocate(buffer, sizeof(T) * capacity, Alignment);
+        }
+
+    private:
+        T* m_data = nullptr;
+        std::uint32_t m_size = 0;
+        std::uint32_t m_capacity = 0;
+    };
+};
+
+struct thin_layout
+{
+    template <typename T, std::size_t Alignment>
+    class state
+    {
+        struct header
+        {
+            std::uint32_t size;
+            std::uint32_t capacity;
+        };
+
+        static constexpr std::size_t block_alignment = std::max(Alignment, alignof(header));
+        // Rounded up so the elements after the header keep the buffer's alignment.
+        static constexpr std::size_t header_bytes = (sizeof(header) + block_alignment - 1) & ~(block_alignment - 1);
+
+    public:
+        static constexpr std::size_t max_capacity =
+            std::min<std::size_t>(std::numeric_limits<std::uint32_t>::max(), (std::numeric_limits<std::size_t>::max() - header_bytes) / sizeof(T));
+
+        T* data() const noexcept
+        {
+            return m_data;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return m_data != nullptr ? header_of(m_data)->size : 0;
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return m_data != nullptr ? header_of(m_data)->capacity : 0;
+        }
+
+        // Only an empty vector has no header, so the size it is set to is 0 already.
+        void set_size(std::size_t size) noexcept
+        {
+            if (m_data != nullptr)
+            {
+                header_of(m_data)->size = static_cast<std::uint32_t>(size);
+            }
+        }
+
+        void assign(T* data, std::size_t size, std::size_t capacity) noexcept
+        {
+            m_data = data;
+            if (data != nullptr)
+            {
+                header_of(data)->size = static_cast<std::uint32_t>(size);
+                header_of(data)->capacity = static_cast<std::uint32_t>(capacity);
+            }
+        }
+
+        template <typename Storage>
+        static T* allocate(std::size_t capacity)
+        {
+            if (capacity == 0)
+            {
+                return nullptr;
+            }
+            void* block = Storage::allocate(header_bytes + sizeof(T) * capacity, block_alignment);
+            new(block) header{ 0, static_cast<std::uint32_t>(capacity) };
+            return reinterpret_cast<T*>(static_cast<char*>(block) + header_bytes);
+        }
+
+        template <typename Storage>
+        static void deallocate(T* buffer, std::size_t capacity)
+        {
+            if (buffer != nullptr)
+            {
+                Storage::deallocate(header_of(buffer), header_bytes + sizeof(T) * capacity, block_alignment);
+            }
+        }
+
+    private:
+        static header* header_of(T* data) noexcept
+        {
+            return std::launder(reinterpret_cast<header*>(reinterpret_cast<char*>(data) - header_bytes));
+        }
+
+        T* m_data = nullptr;
+    };
+};
+
+#endif
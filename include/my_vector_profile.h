@@ -0,0 +1,315 @@
+#ifndef MY_VECTOR_PROFILE_H
+#define MY_VECTOR_PROFILE_H
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <atomic>
+#include <mutex>
+#include <source_location>
+
+// Debug-mode heap profile of my_vector. With MY_VECTOR_PROFILE defined every my_vector remembers
+// the call site that constructed it, and a registry groups the live vectors by site so that
+// write_vector_profile() can show where memory sits in unused capacity. Setting the environment
+// variable MY_VECTOR_PROFILE_REPORT to a path, or to "-" for stderr, also writes the report at
+// exit. Without the macro none of this is compiled into my_vector.
+
+struct vector_profile_usage
+{
+    std::size_t sizeBytes;
+    std::size_t capacityBytes;
+};
+
+using vector_profile_usage_fn = vector_profile_usage (*)(const void*);
+
+class vector_profile_hook;
+
+struct vector_profile_site
+{
+    std::source_location location;
+    vector_profile_site* next = nullptr;
+    vector_profile_hook* liveHead = nullptr;
+    std::size_t liveCount = 0;
+    std::size_t constructedCount = 0;
+    std::atomic<std::size_t> reallocations{ 0 };
+    bool reported = false;
+};
+
+// Totals of one site, summed over its live vectors.
+struct vector_profile_totals
+{
+    std::size_t liveCount = 0;
+    std::size_t constructedCount = 0;
+    std::size_t sizeBytes = 0;
+    std::size_t capacityBytes = 0;
+    std::size_t reallocations = 0;
+
+    std::size_t waste_bytes() const noexcept
+    {
+        return capacityBytes - sizeBytes;
+    }
+
+    double waste_ratio() const noexcept
+    {
+        return capacityBytes == 0 ? 0.0 : static_cast<double>(waste_bytes()) / static_cast<double>(capacityBytes);
+    }
+};
+
+namespace profile_detail
+{
+    struct Registry
+    {
+        std::mutex mutex;
+        vector_profile_site* sites = nullptr;
+    };
+
+    void write_at_exit();
+
+    // Never destroyed, so vectors with static storage can still unregister during exit.
+    inline Registry& registry()
+    {
+        static Registry* instance = []()
+        {
+            std::atexit(write_at_exit);
+            return new Registry;
+        }();
+        return *instance;
+    }
+
+    inline bool same_location(const std::source_location& lhs, const std::source_location& rhs)
+    {
+        return lhs.line() == rhs.line() && lhs.column() == rhs.column()
+            && (lhs.file_name() == rhs.file_name() || std::strcmp(lhs.file_name(), rhs.file_name()) == 0);
+    }
+
+    // Expects the registry mutex to be held.
+    inline vector_profile_site& site_for(const std::source_location& location)
+    {
+        Registry& reg = registry();
+        for (vector_profile_site* site = reg.sites; site != nullptr; site = site->next)
+        {
+            if (same_location(site->location, location))
+            {
+                return *site;
+            }
+        }
+
+        auto* site = new vector_profile_site;
+        site->location = location;
+        site->next = reg.sites;
+        reg.sites = site;
+        return *site;
+    }
+}
+
+// Member of every profiled my_vector. It belongs to the object, not to its buffer: swap and
+// assignment leave it in place.
+class vector_profile_hook
+{
+public:
+    vector_profile_hook() = default;
+    vector_profile_hook(const vector_profile_hook&) = delete;
+    vector_profile_hook& operator=(const vector_profile_hook&) = delete;
+
+    ~vector_profile_hook()
+    {
+        if (m_site == nullptr)
+        {
+            return;
+        }
+
+        std::lock_guard lock(profile_detail::registry().mutex);
+        (m_prev != nullptr ? m_prev->m_next : m_site->liveHead) = m_next;
+        if (m_next != nullptr)
+        {
+            m_next->m_prev = m_prev;
+        }
+        --m_site->liveCount;
+    }
+
+    void attach(const void* owner, vector_profile_usage_fn usage, const std::source_location& location)
+    {
+        std::lock_guard lock(profile_detail::registry().mutex);
+        m_owner = owner;
+        m_usage = usage;
+        m_site = &profile_detail::site_for(location);
+        m_next = m_site->liveHead;
+        if (m_next != nullptr)
+        {
+            m_next->m_prev = this;
+        }
+        m_site->liveHead = this;
+        ++m_site->liveCount;
+        ++m_site->constructedCount;
+    }
+
+    void count_reallocation() noexcept
+    {
+        if (m_site != nullptr)
+        {
+            m_site->reallocations.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    std::source_location location() const noexcept
+    {
+        return m_site != nullptr ? m_site->location : std::source_location{};
+    }
+
+    vector_profile_usage usage() const
+    {
+        return m_usage(m_owner);
+    }
+
+    const vector_profile_hook* next() const noexcept
+    {
+        return m_next;
+    }
+
+private:
+    const void* m_owner = nullptr;
+    vector_profile_usage_fn m_usage = nullptr;
+    vector_profile_site* m_site = nullptr;
+    vector_profile_hook* m_prev = nullptr;
+    vector_profile_hook* m_next = nullptr;
+};
+
+namespace profile_detail
+{
+    // Expects the registry mutex to be held.
+    inline vector_profile_totals totals_of(const vector_profile_site& site)
+    {
+        vector_profile_totals totals;
+        totals.liveCount = site.liveCount;
+        totals.constructedCount = site.constructedCount;
+        totals.reallocations = site.reallocations.load(std::memory_order_relaxed);
+        for (const vector_profile_hook* hook = site.liveHead; hook != nullptr; hook = hook->next())
+        {
+            const vector_profile_usage usage = hook->usage();
+            totals.sizeBytes += usage.sizeBytes;
+            totals.capacityBytes += usage.capacityBytes;
+        }
+
+        return totals;
+    }
+}
+
+// Calls f(location, totals) once per call site that ever constructed a vector. Reads the live
+// vectors' sizes, so it must not race with other threads mutating them.
+template <typename F>
+void for_each_vector_profile_site(F&& f)
+{
+    profile_detail::Registry& reg = profile_detail::registry();
+    std::lock_guard lock(reg.mutex);
+    for (const vector_profile_site* site = reg.sites; site != nullptr; site = site->next)
+    {
+        f(site->location, profile_detail::totals_of(*site));
+    }
+}
+
+inline vector_profile_totals vector_profile_totals_at(const std::source_location& location)
+{
+    vector_profile_totals result;
+    for_each_vector_profile_site([&](const std::source_location& siteLocation, const vector_profile_totals& totals)
+    {
+        if (profile_detail::same_location(siteLocation, location))
+        {
+            result = totals;
+        }
+    });
+
+    return result;
+}
+
+// One line per site, most wasted bytes first. Sites are few, so picking the worst remaining
+// one per line is cheap and needs no container of its own.
+inline void write_vector_profile(std::FILE* out)
+{
+    profile_detail::Registry& reg = profile_detail::registry();
+    std::lock_guard lock(reg.mutex);
+    for (vector_profile_site* site = reg.sites; site != nullptr; site = site->next)
+    {
+        site->reported = false;
+    }
+
+    std::fprintf(out, "%14s %14s %8s %8s %9s  %s\n", "capacity B", "waste B", "waste", "live", "reallocs", "site");
+    while (true)
+    {
+        vector_profile_site* worst = nullptr;
+        vector_profile_totals worstTotals;
+        for (vector_profile_site* site = reg.sites; site != nullptr; site = site->next)
+        {
+            if (site->reported)
+            {
+                continue;
+            }
+            const vector_profile_totals totals = profile_detail::totals_of(*site);
+            if (worst == nullptr || totals.waste_bytes() > worstTotals.waste_bytes())
+            {
+                worst = site;
+                worstTotals = totals;
+            }
+        }
+        if (worst == nullptr)
+        {
+            break;
+        }
+
+        worst->reported = true;
+        std::fprintf(out, "%14zu %14zu %7.1f%% %8zu %9zu  %s:%u %s\n", worstTotals.capacityBytes, worstTotals.waste_bytes(),
+            worstTotals.waste_ratio() * 100.0, worstTotals.liveCount, worstTotals.reallocations,
+            worst->location.file_name(), static_cast<unsigned>(worst->location.line()), worst->location.function_name());
+    }
+    std::fflush(out);
+}
+
+namespace profile_detail
+{
+    inline void write_at_exit()
+    {
+        const char* path = std::getenv("MY_VECTOR_PROFILE_REPORT");
+        if (path == nullptr || *path == '\0')
+        {
+            return;
+        }
+
+        if (std::strcmp(path, "-") == 0)
+        {
+            write_vector_profile(stderr);
+        }
+        else if (std::FILE* out = std::fopen(path, "w"))
+        {
+            write_vector_profile(out);
+            std::fclose(out);
+        }
+    }
+}
+
+// The default constructor's parameter. Being a class of its own, rather than a
+// std::source_location, it does not make my_vector implicitly convertible from one.
+struct vector_profile_location
+{
+    vector_profile_location(std::source_location callSite = std::source_location::current()) noexcept :
+        location(callSite)
+    {
+    }
+
+    std::source_location location;
+};
+
+// Constructor plumbing for my_vector: the extra defaulted parameter captures the caller's
+// source location, and internal temporaries are attributed to the vector they serve.
+#ifdef MY_VECTOR_PROFILE
+#define MY_VECTOR_PROFILE_LOCATION_ARG , std::source_location profileLocation = std::source_location::current()
+#define MY_VECTOR_PROFILE_SAME_SITE , m_profile.location()
+#define MY_VECTOR_PROFILE_ATTACH() m_profile.attach(this, &profile_usage, profileLocation)
+#define MY_VECTOR_PROFILE_REALLOCATION() m_profile.count_reallocation()
+#else
+#define MY_VECTOR_PROFILE_LOCATION_ARG
+#define MY_VECTOR_PROFILE_SAME_SITE
+#define MY_VECTOR_PROFILE_ATTACH() ((void)0)
+#define MY_VECTOR_PROFILE_REALLOCATION() ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef MY_VECTOR_TRACE_H
+#define MY_VECTOR_TRACE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <atomic>
+#include <chrono>
+
+#include <unistd.h>
+
+#include "my_array.h"
+
+#if defined(MY_VECTOR_TRACE) && __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define MY_VECTOR_TRACE_USDT
+#endif
+
+// Events kept by the trace ring; once it is full the oldest are overwritten.
+#ifndef MY_VECTOR_TRACE_CAPACITY
+#define MY_VECTOR_TRACE_CAPACITY 65536
+#endif
+
+struct trace_event
+{
+    const char* name;
+    std::uint64_t startNs;
+    std::uint64_t durationNs;
+    std::uint32_t thread;
+    std::size_t elements;
+    std::size_t bytes;
+};
+
+namespace trace_detail
+{
+    inline constexpr std::size_t capacity = MY_VECTOR_TRACE_CAPACITY;
+
+    inline my_array<trace_event, capacity> ring{};
+    inline std::atomic<std::uint64_t> written{ 0 };
+    inline std::atomic<std::uint32_t> threadsCount{ 0 };
+
+    inline std::uint32_t thread_number()
+    {
+        thread_local const std::uint32_t number = threadsCount.fetch_add(1, std::memory_order_relaxed) + 1;
+        return number;
+    }
+
+    // steady_clock is CLOCK_MONOTONIC on Linux, the clock perf and most request tracers use,
+    // so the timestamps line up with theirs without conversion.
+    inline std::uint64_t now_ns()
+    {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+}
+
+inline void trace_record(const char* name, std::uint64_t startNs, std::uint64_t durationNs, std::size_t elements, std::size_t bytes)
+{
+    const std::uint64_t index = trace_detail::written.fetch_add(1, std::memory_order_relaxed);
+    trace_detail::ring[index % trace_detail::capacity] = { name, startNs, durationNs, trace_detail::thread_number(), elements, bytes };
+}
+
+// Records one complete event covering its own lifetime.
+class trace_scope
+{
+public:
+    trace_scope(const char* name, std::size_t elements, std::size_t bytes) :
+        m_name(name),
+        m_elements(elements),
+        m_bytes(bytes),
+        m_startNs(trace_detail::now_ns())
+    {
+    }
+
+    trace_scope(const trace_scope&) = delete;
+    trace_scope& operator=(const trace_scope&) = delete;
+
+    ~trace_scope()
+    {
+        trace_record(m_name, m_startNs, trace_detail::now_ns() - m_startNs, m_elements, m_bytes);
+    }
+
+private:
+    const char* m_name;
+    std::size_t m_elements;
+    std::size_t m_bytes;
+    std::uint64_t m_startNs;
+};
+
+inline std::size_t trace_event_count()
+{
+    const std::uint64_t written = trace_detail::written.load(std::memory_order_relaxed);
+    return written < trace_detail::capacity ? static_cast<std::size_t>(written) : trace_detail::capacity;
+}
+
+inline std::uint64_t trace_overwritten_count()
+{
+    const std::uint64_t written = trace_detail::written.load(std::memory_order_relaxed);
+    return written > trace_detail::capacity ? written - trace_detail::capacity : 0;
+}
+
+// The i-th oldest event still in the ring.
+inline const trace_event& trace_event_at(std::size_t i)
+{
+    return trace_detail::ring[(trace_overwritten_count() + i) % trace_detail::capacity];
+}
+
+inline void trace_clear()
+{
+    trace_detail::written.store(0, std::memory_order_relaxed);
+}
+
+// Writes the ring as Chrome trace event JSON, loadable by chrome://tracing and Perfetto.
+// Must not run while other threads are still recording.
+inline bool write_chrome_trace(std::FILE* out)
+{
+    const long pid = static_cast<long>(getpid());
+    std::fprintf(out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    for (std::size_t i = 0; i < trace_event_count(); ++i)
+    {
+        const trace_event& event = trace_event_at(i);
+        std::fprintf(out, "%s\n{\"name\":\"%s\",\"cat\":\"my_vector\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+            "\"pid\":%ld,\"tid\":%u,\"args\":{\"elements\":%zu,\"bytes\":%zu}}",
+            i == 0 ? "" : ",", event.name, event.startNs / 1e3, event.durationNs / 1e3, pid,
+            static_cast<unsigned>(event.thread), event.elements, event.bytes);
+    }
+    std::fprintf(out, "\n]}\n");
+
+    return std::ferror(out) == 0;
+}
+
+inline bool write_chrome_trace(const char* path)
+{
+    std::FILE* out = std::fopen(path, "w");
+    if (out == nullptr)
+    {
+        return false;
+    }
+    const bool written = write_chrome_trace(out);
+
+    return std::fclose(out) == 0 && written;
+}
+
+// my_vector calls this at reallocate, range insert, erase and shrink_to_fit. Unless
+// MY_VECTOR_TRACE is defined it expands to nothing and its arguments are never evaluated.
+// With <sys/sdt.h> available each site is also a USDT probe my_vector:<name>(elements, bytes)
+// for perf, bpftrace or SystemTap.
+#if defined(MY_VECTOR_TRACE) && defined(MY_VECTOR_TRACE_USDT)
+#define MY_VECTOR_TRACE_SCOPE(name, elements, bytes) \
+    DTRACE_PROBE2(my_vector, name, elements, bytes); \
+    trace_scope myVectorTraceScope(#name, elements, bytes)
+#elif defined(MY_VECTOR_TRACE)
+#define MY_VECTOR_TRACE_SCOPE(name, elements, bytes) trace_scope myVectorTraceScope(#name, elements, bytes)
+#else
+#define MY_VECTOR_TRACE_SCOPE(name, elements, bytes) ((void)0)
+#endif
+
+#endif
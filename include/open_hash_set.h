@@ -0,0 +1,248 @@
+#ifndef OPEN_HASH_SET_H
+#define OPEN_HASH_SET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <bit>
+#include <functional>
+#include <type_traits>
+
+#include "my_array.h"
+#include "my_vector.h"
+
+// Finalizer of MurmurHash3: spreads every input bit over the whole word.
+inline std::uint64_t mix64(std::uint64_t x) noexcept
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdull;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ull;
+    x ^= x >> 33;
+    return x;
+}
+
+template <typename T>
+inline constexpr bool set_hash_integer_v = std::is_integral_v<T>
+#ifdef __SIZEOF_INT128__
+    || std::is_same_v<std::remove_cv_t<T>, __int128> || std::is_same_v<std::remove_cv_t<T>, unsigned __int128>
+#endif
+    ;
+
+// Arithmetic values up to 64 bits are hashed from their bit pattern with mix64, which is branch
+// free so batches of keys hash in vector registers, and wider integers one word at a time.
+// Other types, long double among them since it has padding bytes, go through std::hash first.
+template <typename T>
+struct set_hash
+{
+    std::uint64_t operator()(const T& value) const noexcept
+    {
+        if constexpr (std::is_arithmetic_v<T> && sizeof(T) <= sizeof(std::uint64_t))
+        {
+            // Adding zero turns -0.0 into 0.0, so equal floats hash equally.
+            const T normalized = std::is_floating_point_v<T> ? value + T{ 0 } : value;
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, &normalized, sizeof(T));
+            return mix64(bits);
+        }
+        else if constexpr (set_hash_integer_v<T>)
+        {
+            static_assert(sizeof(T) % sizeof(std::uint64_t) == 0);
+            std::uint64_t words[sizeof(T) / sizeof(std::uint64_t)];
+            std::memcpy(words, &value, sizeof(T));
+            std::uint64_t hash = 0;
+            for (const std::uint64_t word : words)
+            {
+                hash = mix64(hash ^ word);
+            }
+            return hash;
+        }
+        else
+        {
+            return mix64(std::hash<T>{}(value));
+        }
+    }
+};
+
+// Linear-probing hash set kept in two my_vectors: a byte per slot holding an occupied bit plus
+// seven hash bits, and the slots themselves. Probes compare the control bytes first, so most
+// mismatches never touch T. Capacity is a power of two and the load stays at or below 1/2.
+// Elements cannot be erased; T must be default constructible.
+template <typename T, typename Hash = set_hash<T>, typename Equal = std::equal_to<T>>
+class open_hash_set
+{
+public:
+    using value_type = T;
+
+    open_hash_set() = default;
+
+    explicit open_hash_set(std::size_t expectedCount)
+    {
+        reserve(expectedCount);
+    }
+
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    bool is_empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    std::size_t slots_count() const noexcept
+    {
+        return m_control.size();
+    }
+
+    const Hash& hash_function() const noexcept
+    {
+        return m_hash;
+    }
+
+    void reserve(std::size_t count)
+    {
+        const std::size_t wanted = std::bit_ceil(std::max<std::size_t>(count * 2, 16));
+        if (wanted > slots_count())
+        {
+            rehash(wanted);
+        }
+    }
+
+    bool insert(const value_type& value)
+    {
+        return insert_hashed(value, m_hash(value));
+    }
+
+    bool contains(const value_type& value) const
+    {
+        return contains_hashed(value, m_hash(value));
+    }
+
+    // Same as insert/contains with a hash computed up front by hash_function().
+    bool insert_hashed(const value_type& value, std::uint64_t hash)
+    {
+        if ((m_size + 1) * 2 > slots_count())
+        {
+            rehash(std::max<std::size_t>(slots_count() * 2, 16));
+        }
+
+        const std::uint8_t tag = tag_of(hash);
+        const std::size_t mask = slots_count() - 1;
+        for (std::size_t i = hash & mask; ; i = (i + 1) & mask)
+        {
+            if (m_control[i] == 0)
+            {
+                m_control[i] = tag;
+                m_slots[i] = value;
+                ++m_size;
+                return true;
+            }
+            if (m_control[i] == tag && m_equal(m_slots[i], value))
+            {
+                return false;
+            }
+        }
+    }
+
+    bool contains_hashed(const value_type& value, std::uint64_t hash) const
+    {
+        if (m_size == 0)
+        {
+            return false;
+        }
+
+        const std::uint8_t tag = tag_of(hash);
+        const std::size_t mask = slots_count() - 1;
+        for (std::size_t i = hash & mask; m_control[i] != 0; i = (i + 1) & mask)
+        {
+            if (m_control[i] == tag && m_equal(m_slots[i], value))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Pulls in the home slot of a hash ahead of the probe that will need it.
+    void prefetch(std::uint64_t hash) const noexcept
+    {
+        if (m_size != 0)
+        {
+            const std::size_t i = hash & (slots_count() - 1);
+            __builtin_prefetch(m_control.data() + i);
+            __builtin_prefetch(m_slots.data() + i);
+        }
+    }
+
+    void clear()
+    {
+        std::fill(m_control.begin(), m_control.end(), std::uint8_t{ 0 });
+        m_size = 0;
+    }
+
+private:
+    static std::uint8_t tag_of(std::uint64_t hash) noexcept
+    {
+        return static_cast<std::uint8_t>((hash >> 57) | 0x80);
+    }
+
+    void rehash(std::size_t newSlotsCount)
+    {
+        my_vector<std::uint8_t> oldControl;
+        my_vector<value_type> oldSlots;
+        oldControl.swap(m_control);
+        oldSlots.swap(m_slots);
+
+        m_control.reserve(newSlotsCount);
+        m_control.resize(newSlotsCount, 0);
+        m_slots.reserve(newSlotsCount);
+        m_slots.resize(newSlotsCount);
+        m_size = 0;
+
+        for (std::size_t i = 0; i < oldControl.size(); ++i)
+        {
+            if (oldControl[i] != 0)
+            {
+                insert_hashed(oldSlots[i], m_hash(oldSlots[i]));
+            }
+        }
+    }
+
+    my_vector<std::uint8_t> m_control;
+    my_vector<value_type> m_slots;
+    std::size_t m_size = 0;
+    [[no_unique_address]] Hash m_hash;
+    [[no_unique_address]] Equal m_equal;
+};
+
+// Calls f(value, hash) for every element in order. Hashes are computed a block at a time, which
+// lets the compiler vectorize the hash loop for arithmetic T, and all home slots of a block are
+// prefetched from table before the first of them is probed.
+template <typename T, typename Table, typename F>
+void for_each_hashed(const T* data, std::size_t n, const Table& table, F&& f)
+{
+    constexpr std::size_t block = 16;
+
+    my_array<std::uint64_t, block> hashes{};
+    for (std::size_t start = 0; start < n; start += block)
+    {
+        const std::size_t count = std::min(block, n - start);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            hashes[i] = table.hash_function()(data[start + i]);
+        }
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            table.prefetch(hashes[i]);
+        }
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            f(data[start + i], hashes[i]);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,348 @@
+#ifndef PERSISTENT_VECTOR_H
+#define PERSISTENT_VECTOR_H
+
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <initializer_list>
+
+#include "my_array.h"
+#include "my_vector.h"
+
+class persistent_vector_out_of_range final : std::exception
+{
+public:
+    const char* what() const noexcept override
+    {
+        return "persistent_vector out of range";
+    }
+};
+
+// Immutable vector stored as a 32-way radix-balanced trie plus a separate tail leaf. Copies
+// share the whole tree; push_back and set copy only the O(log32 n) nodes on the modified path.
+// Batch edits go through a transient, which mutates the nodes it already owns in place.
+// Leaves are my_arrays, so T must be default constructible.
+template <typename T>
+class persistent_vector
+{
+    static constexpr std::size_t bits = 5;
+    static constexpr std::size_t branching = std::size_t{ 1 } << bits;
+    static constexpr std::size_t mask = branching - 1;
+
+    struct Node
+    {
+    };
+
+    struct Internal : Node
+    {
+        my_array<std::shared_ptr<Node>, branching> children{};
+    };
+
+    struct Leaf : Node
+    {
+        my_array<T, branching> values{};
+    };
+
+public:
+    using value_type = T;
+
+    class transient
+    {
+    public:
+        transient() = default;
+
+        explicit transient(const persistent_vector& vector) :
+            m_size{ vector.m_size },
+            m_shift{ vector.m_shift },
+            m_root{ vector.m_root },
+            m_tail{ vector.m_tail }
+        {
+        }
+
+        std::size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+        void push_back(value_type elem)
+        {
+            if (m_size - tail_offset(m_size) < branching)
+            {
+                make_editable<Leaf>(m_tail)->values[m_size & mask] = std::move(elem);
+                ++m_size;
+                return;
+            }
+
+            if ((m_size >> bits) > (std::size_t{ 1 } << m_shift))
+            {
+                auto newRoot = std::make_shared<Internal>();
+                newRoot->children[0] = std::move(m_root);
+                m_root = std::move(newRoot);
+                m_shift += bits;
+            }
+            push_tail(m_shift, m_root);
+
+            auto newTail = std::make_shared<Leaf>();
+            newTail->values[0] = std::move(elem);
+            m_tail = std::move(newTail);
+            ++m_size;
+        }
+
+        void set(std::size_t i, value_type elem)
+        {
+            if (i >= m_size)
+            {
+                throw persistent_vector_out_of_range{};
+            }
+
+            if (i >= tail_offset(m_size))
+            {
+                make_editable<Leaf>(m_tail)->values[i & mask] = std::move(elem);
+                return;
+            }
+
+            Internal* node = make_editable<Internal>(m_root);
+            for (std::size_t level = m_shift; level > bits; level -= bits)
+            {
+                node = make_editable<Internal>(node->children[(i >> level) & mask]);
+            }
+            make_editable<Leaf>(node->children[(i >> bits) & mask])->values[i & mask] = std::move(elem);
+        }
+
+        // Hands the edited tree over to an immutable vector and leaves the transient empty.
+        persistent_vector persistent()
+        {
+            persistent_vector result;
+            result.m_size = std::exchange(m_size, 0);
+            result.m_shift = std::exchange(m_shift, bits);
+            result.m_root = std::move(m_root);
+            result.m_tail = std::move(m_tail);
+
+            return result;
+        }
+
+    private:
+        template <typename NodeType>
+        static NodeType* make_editable(std::shared_ptr<Node>& node)
+        {
+            if (!node)
+            {
+                node = std::make_shared<NodeType>();
+            }
+            else if (node.use_count() != 1)
+            {
+                node = std::make_shared<NodeType>(*static_cast<const NodeType*>(node.get()));
+            }
+
+            return static_cast<NodeType*>(node.get());
+        }
+
+        void push_tail(std::size_t level, std::shared_ptr<Node>& parent)
+        {
+            Internal* node = make_editable<Internal>(parent);
+            std::shared_ptr<Node>& child = node->children[((m_size - 1) >> level) & mask];
+            if (level == bits)
+            {
+                child = std::move(m_tail);
+            }
+            else
+            {
+                push_tail(level - bits, child);
+            }
+        }
+
+        std::size_t m_size = 0;
+        std::size_t m_shift = bits;
+        std::shared_ptr<Node> m_root;
+        std::shared_ptr<Node> m_tail;
+    };
+
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() = default;
+
+        const_iterator(const persistent_vector* vector, std::size_t index) :
+            m_vector(vector),
+            m_index(index)
+        {
+        }
+
+        reference operator*() const
+        {
+            if (m_leaf == nullptr || (m_index & ~mask) != m_leafStart)
+            {
+                m_leafStart = m_index & ~mask;
+                m_leaf = m_vector->leaf_for(m_index);
+            }
+            return m_leaf->values[m_index & mask];
+        }
+
+        pointer operator->() const
+        {
+            return &**this;
+        }
+
+        const_iterator& operator++()
+        {
+            ++m_index;
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator result = *this;
+            ++m_index;
+            return result;
+        }
+
+        bool operator==(const const_iterator& other) const
+        {
+            return m_index == other.m_index;
+        }
+
+    private:
+        const persistent_vector* m_vector = nullptr;
+        std::size_t m_index = 0;
+        mutable const Leaf* m_leaf = nullptr;
+        mutable std::size_t m_leafStart = 0;
+    };
+
+    persistent_vector() = default;
+
+    persistent_vector(std::initializer_list<value_type> initializerList)
+    {
+        transient builder;
+        for (const value_type& elem : initializerList)
+        {
+            builder.push_back(elem);
+        }
+        *this = builder.persistent();
+    }
+
+    explicit persistent_vector(const my_vector<value_type>& vector)
+    {
+        transient builder;
+        for (std::size_t i = 0; i < vector.size(); ++i)
+        {
+            builder.push_back(vector[i]);
+        }
+        *this = builder.persistent();
+    }
+
+    const value_type& at(std::size_t i) const
+    {
+        if (i < m_size)
+        {
+            return (*this)[i];
+        }
+        throw persistent_vector_out_of_range{};
+    }
+
+    const value_type& operator[](std::size_t i) const
+    {
+        return leaf_for(i)->values[i & mask];
+    }
+
+    const value_type& front() const
+    {
+        return (*this)[0];
+    }
+
+    const value_type& back() const
+    {
+        return (*this)[m_size - 1];
+    }
+
+    bool is_empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(this, m_size);
+    }
+
+    [[nodiscard]] persistent_vector push_back(value_type elem) const
+    {
+        transient builder(*this);
+        builder.push_back(std::move(elem));
+        return builder.persistent();
+    }
+
+    [[nodiscard]] persistent_vector set(std::size_t i, value_type elem) const
+    {
+        transient builder(*this);
+        builder.set(i, std::move(elem));
+        return builder.persistent();
+    }
+
+    transient to_transient() const
+    {
+        return transient(*this);
+    }
+
+    my_vector<value_type> to_my_vector() const
+    {
+        my_vector<value_type> result;
+        result.reserve(m_size);
+        for (std::size_t leafStart = 0; leafStart < m_size; leafStart += branching)
+        {
+            const Leaf* leaf = leaf_for(leafStart);
+            for (std::size_t i = 0; i < branching && leafStart + i < m_size; ++i)
+            {
+                result.push_back(leaf->values[i]);
+            }
+        }
+
+        return result;
+    }
+
+private:
+    static std::size_t tail_offset(std::size_t size)
+    {
+        return size < branching ? 0 : ((size - 1) >> bits) << bits;
+    }
+
+    const Leaf* leaf_for(std::size_t i) const
+    {
+        if (i >= tail_offset(m_size))
+        {
+            return static_cast<const Leaf*>(m_tail.get());
+        }
+
+        const Node* node = m_root.get();
+        for (std::size_t level = m_shift; level > 0; level -= bits)
+        {
+            node = static_cast<const Internal*>(node)->children[(i >> level) & mask].get();
+        }
+
+        return static_cast<const Leaf*>(node);
+    }
+
+    std::size_t m_size = 0;
+    std::size_t m_shift = bits;
+    std::shared_ptr<Node> m_root;
+    std::shared_ptr<Node> m_tail;
+};
+
+#endif
@@ -0,0 +1,163 @@
+#ifndef PREFAULT_H
+#define PREFAULT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <stop_token>
+#include <thread>
+#include <utility>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "my_vector.h"
+
+// How reserve(vec, n, policy) faults in the pages of a fresh buffer ahead of use. A
+// multi-GB reserve otherwise returns at once and leaves every page fault, and the kernel zeroing
+// each page, to the first pass that writes the elements.
+//
+//     populate         the calling thread has the kernel populate the pages before returning
+//     parallel_touch   one slice per thread, joined before returning, so the zeroing is spread
+//                      over cores; the pages also end up on the NUMA nodes of those threads
+//     background       one thread populates while the caller carries on, possibly already
+//                      writing elements; the returned handle says when it is done
+//
+// Pages are populated with MADV_POPULATE_WRITE, which never changes what the memory holds, so
+// elements already in the buffer and writes racing with the background thread are safe. On
+// kernels before 5.14 it falls back to an atomic no-op write to one byte per page. MAP_POPULATE
+// would need the storage policy's own mmap call, and MADV_WILLNEED does not populate anonymous
+// memory at all.
+enum class prefault_policy
+{
+    populate,
+    parallel_touch,
+    background
+};
+
+// Completion of a prefault, ready at once unless it runs in the background. Destroying it or
+// assigning over it stops a background prefault and waits for the thread, so it has to go
+// before the buffer does, i.e. before the my_vector reallocates or is destroyed.
+class [[nodiscard]] prefault_handle
+{
+public:
+    prefault_handle() = default;
+
+    prefault_handle(std::unique_ptr<std::atomic<bool>> done, std::jthread thread) :
+        m_done(std::move(done)),
+        m_thread(std::move(thread))
+    {
+    }
+
+    bool is_ready() const
+    {
+        return m_done == nullptr || m_done->load(std::memory_order_acquire);
+    }
+
+    // Blocks until the prefault is done.
+    void wait()
+    {
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+private:
+    // Not a std::future, whose header would add a third to the compile time of my_vector.h.
+    std::unique_ptr<std::atomic<bool>> m_done;
+    // Declared last so that it is destroyed, and joined, first.
+    std::jthread m_thread;
+};
+
+namespace prefault_detail
+{
+    // Slices and background steps are this big, so a stop request is seen within one of them.
+    inline constexpr std::size_t chunk_bytes = std::size_t{ 2 } << 20;
+
+    inline std::size_t page_size()
+    {
+        static const std::size_t size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        return size;
+    }
+
+    inline void populate(char* begin, char* end)
+    {
+        if (begin >= end)
+        {
+            return;
+        }
+
+        const std::size_t pageSize = page_size();
+        char* page = reinterpret_cast<char*>(reinterpret_cast<std::uintptr_t>(begin) & ~(pageSize - 1));
+#ifdef MADV_POPULATE_WRITE
+        if (madvise(page, static_cast<std::size_t>(end - page), MADV_POPULATE_WRITE) == 0)
+        {
+            return;
+        }
+#endif
+        std::atomic_ref<char>(*begin).fetch_or(0, std::memory_order_relaxed);
+        for (page += pageSize; page < end; page += pageSize)
+        {
+            std::atomic_ref<char>(*page).fetch_or(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+inline prefault_handle prefault(void* buffer, std::size_t bytes, prefault_policy policy,
+    std::size_t threadsCount = std::thread::hardware_concurrency())
+{
+    char* const begin = static_cast<char*>(buffer);
+    char* const end = begin + bytes;
+
+    if (policy == prefault_policy::populate)
+    {
+        prefault_detail::populate(begin, end);
+        return {};
+    }
+
+    if (policy == prefault_policy::parallel_touch)
+    {
+        const std::size_t slices = std::clamp<std::size_t>(std::min(threadsCount, bytes / prefault_detail::chunk_bytes), 1, 64);
+        const std::size_t sliceBytes = (bytes / slices + prefault_detail::page_size() - 1) & ~(prefault_detail::page_size() - 1);
+        {
+            // The caller takes the first slice; the jthreads join when the array goes.
+            auto threads = std::make_unique<std::jthread[]>(slices - 1);
+            for (std::size_t i = 1; i < slices; ++i)
+            {
+                char* const sliceBegin = begin + std::min(bytes, i * sliceBytes);
+                char* const sliceEnd = begin + std::min(bytes, (i + 1) * sliceBytes);
+                threads[i - 1] = std::jthread(prefault_detail::populate, sliceBegin, sliceEnd);
+            }
+            prefault_detail::populate(begin, begin + std::min(bytes, sliceBytes));
+        }
+        return {};
+    }
+
+    auto done = std::make_unique<std::atomic<bool>>(false);
+    std::jthread thread([begin, end, done = done.get()](std::stop_token stop)
+    {
+        for (char* chunk = begin; chunk < end && !stop.stop_requested();)
+        {
+            char* const chunkEnd = static_cast<std::size_t>(end - chunk) > prefault_detail::chunk_bytes ? chunk + prefault_detail::chunk_bytes : end;
+            prefault_detail::populate(chunk, chunkEnd);
+            chunk = chunkEnd;
+        }
+        done->store(true, std::memory_order_release);
+    });
+    return prefault_handle(std::move(done), std::move(thread));
+}
+
+// Reserves, then faults in the pages past the elements so that filling them does not stall on
+// page faults. A free function rather than a member, so that my_vector.h does not pull in
+// <thread> and the POSIX headers. Wait for or drop a background handle before vec reallocates.
+template <typename T, std::size_t Align, typename Storage, typename Layout>
+prefault_handle reserve(my_vector<T, Align, Storage, Layout>& vec, std::size_t newCapacity, prefault_policy policy)
+{
+    vec.reserve(newCapacity);
+    return prefault(vec.data() + vec.size(), (vec.capacity() - vec.size()) * sizeof(T), policy);
+}
+
+#endif
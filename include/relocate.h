@@ -0,0 +1,44 @@
+#ifndef RELOCATE_H
+#define RELOCATE_H
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Moves count elements to raw memory at to and destroys the originals. The two ranges may
+// overlap within one buffer: walking in the direction of the move means every destination slot
+// has been vacated before an element is constructed into it.
+template <typename T>
+void relocate_elements(T* from, std::size_t count, T* to)
+{
+    if (from == to || count == 0)
+    {
+        return;
+    }
+
+    if constexpr (std::is_trivially_copyable_v<T>)
+    {
+        std::memmove(static_cast<void*>(to), from, count * sizeof(T));
+    }
+    else if (std::less<>{}(to, from))
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            new(to + i) T(std::move(from[i]));
+            from[i].~T();
+        }
+    }
+    else
+    {
+        for (std::size_t i = count; i-- > 0;)
+        {
+            new(to + i) T(std::move(from[i]));
+            from[i].~T();
+        }
+    }
+}
+
+#endif
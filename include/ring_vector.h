@@ -0,0 +1,508 @@
+#ifndef RING_VECTOR_H
+#define RING_VECTOR_H
+
+#include <cstddef>
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "my_span.h"
+#include "my_vector.h"
+
+struct overwrite_oldest_t
+{
+    explicit overwrite_oldest_t() = default;
+};
+
+inline constexpr overwrite_oldest_t overwrite_oldest{};
+
+// Circular buffer that grows by doubling, for FIFO windows where my_vector would pay an O(n)
+// erase(begin()) per event. The elements start at m_head and wrap around the end of the buffer,
+// whose capacity stays a power of two so that wrapping is a mask. Built with overwrite_oldest
+// it never grows past a fixed size: pushing onto a full ring drops the element at the other
+// end instead. It never shrinks on its own.
+template <typename T, typename Storage = default_storage>
+class ring_vector
+{
+    template <typename U>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::remove_cv_t<U>;
+        using pointer = U*;
+        using reference = U&;
+
+        Iterator() = default;
+
+        // position counts from the start of the buffer without wrapping, so end() stays
+        // distinct from begin() on a full ring.
+        Iterator(pointer data, std::size_t mask, std::size_t position) :
+            m_data(data),
+            m_mask(mask),
+            m_position(position)
+        {
+        }
+
+        reference operator*() const { return m_data[m_position & m_mask]; }
+        pointer operator->() const { return m_data + (m_position & m_mask); }
+
+        Iterator& operator++()
+        {
+            ++m_position;
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            return Iterator(m_data, m_mask, m_position++);
+        }
+
+        Iterator& operator--()
+        {
+            --m_position;
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            return Iterator(m_data, m_mask, m_position--);
+        }
+
+        Iterator& operator+=(difference_type offset)
+        {
+            m_position += offset;
+            return *this;
+        }
+
+        Iterator operator+(difference_type offset) const
+        {
+            return Iterator(m_data, m_mask, m_position + offset);
+        }
+
+        friend Iterator operator+(difference_type offset, const Iterator& it)
+        {
+            return it + offset;
+        }
+
+        Iterator& operator-=(difference_type offset)
+        {
+            m_position -= offset;
+            return *this;
+        }
+
+        Iterator operator-(difference_type offset) const
+        {
+            return Iterator(m_data, m_mask, m_position - offset);
+        }
+
+        difference_type operator-(const Iterator& other) const
+        {
+            return static_cast<difference_type>(m_position - other.m_position);
+        }
+
+        reference operator[](difference_type index) const
+        {
+            return m_data[(m_position + index) & m_mask];
+        }
+
+        bool operator==(const Iterator& other) const
+        {
+            return m_position == other.m_position;
+        }
+
+        auto operator<=>(const Iterator& other) const
+        {
+            return m_position <=> other.m_position;
+        }
+
+        operator Iterator<const value_type>() const
+        {
+            return Iterator<const value_type>(m_data, m_mask, m_position);
+        }
+
+    private:
+        pointer m_data = nullptr;
+        std::size_t m_mask = 0;
+        std::size_t m_position = 0;
+    };
+
+public:
+    using value_type = T;
+    using storage_type = Storage;
+
+    using iterator = Iterator<value_type>;
+    using const_iterator = Iterator<const value_type>;
+
+    ring_vector() = default;
+
+    // Fixed-size ring that keeps the newest maxSize elements. maxSize must not be 0.
+    ring_vector(overwrite_oldest_t, std::size_t maxSize) :
+        m_limit{ maxSize }
+    {
+        reallocate(std::bit_ceil(maxSize));
+    }
+
+    ring_vector(const ring_vector& other) :
+        m_limit{ other.m_limit }
+    {
+        if (m_limit != 0)
+        {
+            reallocate(other.m_capacity);
+        }
+        else
+        {
+            reserve(other.m_size);
+        }
+        for (const value_type& elem : other)
+        {
+            new(slot(m_size++)) value_type(elem);
+        }
+    }
+
+    ring_vector(ring_vector&& other) noexcept :
+        m_data{ std::exchange(other.m_data, nullptr) },
+        m_capacity{ std::exchange(other.m_capacity, 0) },
+        m_head{ std::exchange(other.m_head, 0) },
+        m_size{ std::exchange(other.m_size, 0) },
+        m_limit{ std::exchange(other.m_limit, 0) }
+    {
+    }
+
+    ring_vector(std::initializer_list<value_type> initializerList)
+    {
+        reserve(initializerList.size());
+        for (const value_type& elem : initializerList)
+        {
+            push_back(elem);
+        }
+    }
+
+    ~ring_vector()
+    {
+        clear();
+        deallocate(m_data, m_capacity);
+    }
+
+    ring_vector& operator=(const ring_vector& other)
+    {
+        if (this != &other)
+        {
+            ring_vector tmp(other);
+            swap(tmp);
+        }
+
+        return *this;
+    }
+
+    ring_vector& operator=(ring_vector&& other) noexcept
+    {
+        if (this != &other)
+        {
+            ring_vector tmp(std::move(other));
+            swap(tmp);
+        }
+
+        return *this;
+    }
+
+    value_type& at(std::size_t i)
+    {
+        if (i < m_size)
+        {
+            return *slot(i);
+        }
+        throw my_vector_out_of_range{};
+    }
+
+    const value_type& at(std::size_t i) const
+    {
+        if (i < m_size)
+        {
+            return *slot(i);
+        }
+        throw my_vector_out_of_range{};
+    }
+
+    value_type& operator[](std::size_t i)
+    {
+        return *slot(i);
+    }
+
+    const value_type& operator[](std::size_t i) const
+    {
+        return *slot(i);
+    }
+
+    value_type& front()
+    {
+        return m_data[m_head];
+    }
+
+    const value_type& front() const
+    {
+        return m_data[m_head];
+    }
+
+    value_type& back()
+    {
+        return *slot(m_size - 1);
+    }
+
+    const value_type& back() const
+    {
+        return *slot(m_size - 1);
+    }
+
+    bool is_empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    // True when a push would have to drop an element, which only happens with overwrite_oldest.
+    bool is_full() const noexcept
+    {
+        return m_limit != 0 && m_size == m_limit;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    std::size_t capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    // The overwrite_oldest size, or 0 for a ring that grows.
+    std::size_t max_size() const noexcept
+    {
+        return m_limit;
+    }
+
+    // The elements in order as at most two contiguous runs; the second one is empty unless
+    // they wrap around the end of the buffer.
+    std::pair<my_span<value_type>, my_span<value_type>> as_spans() noexcept
+    {
+        const std::size_t firstSize = std::min(m_size, m_capacity - m_head);
+        return { my_span<value_type>(m_data + m_head, firstSize), my_span<value_type>(m_data, m_size - firstSize) };
+    }
+
+    std::pair<my_span<const value_type>, my_span<const value_type>> as_spans() const noexcept
+    {
+        const std::size_t firstSize = std::min(m_size, m_capacity - m_head);
+        return { my_span<const value_type>(m_data + m_head, firstSize), my_span<const value_type>(m_data, m_size - firstSize) };
+    }
+
+    void swap(ring_vector& other) noexcept
+    {
+        std::swap(m_data, other.m_data);
+        std::swap(m_capacity, other.m_capacity);
+        std::swap(m_head, other.m_head);
+        std::swap(m_size, other.m_size);
+        std::swap(m_limit, other.m_limit);
+    }
+
+    iterator begin()
+    {
+        return iterator(m_data, m_capacity - 1, m_head);
+    }
+
+    iterator end()
+    {
+        return iterator(m_data, m_capacity - 1, m_head + m_size);
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(m_data, m_capacity - 1, m_head);
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(m_data, m_capacity - 1, m_head + m_size);
+    }
+
+    const_iterator cbegin() const
+    {
+        return begin();
+    }
+
+    const_iterator cend() const
+    {
+        return end();
+    }
+
+    template <typename U, typename OtherStorage>
+    bool operator==(const ring_vector<U, OtherStorage>& other) const
+    {
+        return std::equal(cbegin(), cend(), other.cbegin(), other.cend());
+    }
+
+    template <typename U, typename OtherStorage>
+    auto operator<=>(const ring_vector<U, OtherStorage>& other) const
+    {
+        return std::lexicographical_compare_three_way(cbegin(), cend(), other.cbegin(), other.cend());
+    }
+
+    // Rounds up to a power of two. Does nothing for an overwrite_oldest ring, whose buffer is
+    // allocated up front.
+    void reserve(std::size_t newCapacity)
+    {
+        if (m_limit == 0 && m_capacity < newCapacity)
+        {
+            reallocate(std::bit_ceil(newCapacity));
+        }
+    }
+
+    void push_back(const value_type& elem)
+    {
+        emplace_back(elem);
+    }
+
+    void push_back(value_type&& elem)
+    {
+        emplace_back(std::move(elem));
+    }
+
+    void push_front(const value_type& elem)
+    {
+        emplace_front(elem);
+    }
+
+    void push_front(value_type&& elem)
+    {
+        emplace_front(std::move(elem));
+    }
+
+    template<class... Args>
+    void emplace_back(Args&&... args)
+    {
+        if (m_size == m_capacity || is_full())
+        {
+            // the arguments may refer to the element about to be dropped or moved
+            value_type elem(std::forward<Args>(args)...);
+            make_room();
+            if (is_full())
+            {
+                pop_front();
+            }
+            new(slot(m_size)) value_type(std::move(elem));
+        }
+        else
+        {
+            new(slot(m_size)) value_type(std::forward<Args>(args)...);
+        }
+        ++m_size;
+    }
+
+    template<class... Args>
+    void emplace_front(Args&&... args)
+    {
+        if (m_size == m_capacity || is_full())
+        {
+            value_type elem(std::forward<Args>(args)...);
+            make_room();
+            if (is_full())
+            {
+                pop_back();
+            }
+            new(m_data + ((m_head - 1) & (m_capacity - 1))) value_type(std::move(elem));
+        }
+        else
+        {
+            new(m_data + ((m_head - 1) & (m_capacity - 1))) value_type(std::forward<Args>(args)...);
+        }
+        m_head = (m_head - 1) & (m_capacity - 1);
+        ++m_size;
+    }
+
+    void pop_front()
+    {
+        m_data[m_head].~value_type();
+        m_head = (m_head + 1) & (m_capacity - 1);
+        --m_size;
+    }
+
+    // Drops the count oldest elements at once, e.g. everything that slid out of a window.
+    void pop_front_n(std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            slot(i)->~value_type();
+        }
+        m_head = (m_head + count) & (m_capacity - 1);
+        m_size -= count;
+    }
+
+    void pop_back()
+    {
+        slot(m_size - 1)->~value_type();
+        --m_size;
+    }
+
+    // Keeps the buffer.
+    void clear()
+    {
+        for (std::size_t i = 0; i < m_size; ++i)
+        {
+            slot(i)->~value_type();
+        }
+        m_head = 0;
+        m_size = 0;
+    }
+
+private:
+    value_type* slot(std::size_t i) const noexcept
+    {
+        return m_data + ((m_head + i) & (m_capacity - 1));
+    }
+
+    void make_room()
+    {
+        if (m_size == m_capacity && m_limit == 0)
+        {
+            reallocate(m_capacity != 0 ? m_capacity << 1 : 1);
+        }
+    }
+
+    // Unwraps the elements to the start of the new buffer.
+    void reallocate(std::size_t newCapacity)
+    {
+        value_type* newBuffer = allocate(newCapacity);
+        for (std::size_t i = 0; i < m_size; ++i)
+        {
+            value_type* elem = slot(i);
+            new(newBuffer + i) value_type(std::move(*elem));
+            elem->~value_type();
+        }
+        deallocate(m_data, m_capacity);
+        m_data = newBuffer;
+        m_capacity = newCapacity;
+        m_head = 0;
+    }
+
+    static value_type* allocate(std::size_t count)
+    {
+        return static_cast<value_type*>(storage_type::allocate(sizeof(value_type) * count, alignof(value_type)));
+    }
+
+    static void deallocate(value_type* buffer, std::size_t count)
+    {
+        storage_type::deallocate(buffer, sizeof(value_type) * count, alignof(value_type));
+    }
+
+    value_type* m_data = nullptr;
+    std::size_t m_capacity = 0;
+    std::size_t m_head = 0;
+    std::size_t m_size = 0;
+    std::size_t m_limit = 0;
+};
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef SET_OPS_H
+#define SET_OPS_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "my_vector.h"
+#include "open_hash_set.h"
+#include "hyperloglog.h"
+
+// Bulk set operations over unsorted my_vectors in expected O(n), built on open_hash_set.
+// Results keep the first occurrence of every element, in input order.
+
+template <typename T, std::size_t Align, typename Storage, typename Layout>
+my_vector<T, Align, Storage, Layout> dedupe(const my_vector<T, Align, Storage, Layout>& input)
+{
+    open_hash_set<T> seen(input.size());
+    my_vector<T, Align, Storage, Layout> result;
+    for_each_hashed(input.data(), input.size(), seen, [&](const T& value, std::uint64_t hash)
+    {
+        if (seen.insert_hashed(value, hash))
+        {
+            result.push_back(value);
+        }
+    });
+
+    return result;
+}
+
+// Distinct elements of lhs that also occur in rhs.
+template <typename T, std::size_t Align, typename Storage, typename Layout, std::size_t OtherAlign, typename OtherStorage, typename OtherLayout>
+my_vector<T, Align, Storage, Layout> intersect(const my_vector<T, Align, Storage, Layout>& lhs, const my_vector<T, OtherAlign, OtherStorage, OtherLayout>& rhs)
+{
+    open_hash_set<T> other(rhs.size());
+    for_each_hashed(rhs.data(), rhs.size(), other, [&](const T& value, std::uint64_t hash)
+    {
+        other.insert_hashed(value, hash);
+    });
+
+    open_hash_set<T> seen;
+    my_vector<T, Align, Storage, Layout> result;
+    for_each_hashed(lhs.data(), lhs.size(), other, [&](const T& value, std::uint64_t hash)
+    {
+        if (other.contains_hashed(value, hash) && seen.insert_hashed(value, hash))
+        {
+            result.push_back(value);
+        }
+    });
+
+    return result;
+}
+
+// Distinct elements of lhs that do not occur in rhs.
+template <typename T, std::size_t Align, typename Storage, typename Layout, std::size_t OtherAlign, typename OtherStorage, typename OtherLayout>
+my_vector<T, Align, Storage, Layout> difference(const my_vector<T, Align, Storage, Layout>& lhs, const my_vector<T, OtherAlign, OtherStorage, OtherLayout>& rhs)
+{
+    open_hash_set<T> other(rhs.size());
+    for_each_hashed(rhs.data(), rhs.size(), other, [&](const T& value, std::uint64_t hash)
+    {
+        other.insert_hashed(value, hash);
+    });
+
+    open_hash_set<T> seen;
+    my_vector<T, Align, Storage, Layout> result;
+    for_each_hashed(lhs.data(), lhs.size(), other, [&](const T& value, std::uint64_t hash)
+    {
+        if (!other.contains_hashed(value, hash) && seen.insert_hashed(value, hash))
+        {
+            result.push_back(value);
+        }
+    });
+
+    return result;
+}
+
+template <typename T, std::size_t Align, typename Storage, typename Layout>
+std::size_t count_distinct(const my_vector<T, Align, Storage, Layout>& input)
+{
+    open_hash_set<T> seen(input.size());
+    for_each_hashed(input.data(), input.size(), seen, [&](const T& value, std::uint64_t hash)
+    {
+        seen.insert_hashed(value, hash);
+    });
+
+    return seen.size();
+}
+
+// HyperLogLog estimate in fixed memory, for inputs whose exact distinct set does not fit.
+template <typename T, std::size_t Align, typename Storage, typename Layout>
+double count_distinct_approx(const my_vector<T, Align, Storage, Layout>& input, std::size_t precision = 14)
+{
+    hyperloglog counter(precision);
+    const set_hash<T> hash;
+    for (std::size_t i = 0; i < input.size(); ++i)
+    {
+        counter.add_hash(hash(input[i]));
+    }
+
+    return counter.estimate();
+}
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <cstddef>
+#include <atomic>
+#include <algorithm>
+#include <utility>
+
+#include "my_array.h"
+#include "cache_line.h"
+
+// Bounded queue for exactly one producer thread and one consumer thread. The indices grow
+// monotonically and are masked on access, so N must be a power of two. Each side keeps a
+// cached copy of the other side's index and only reloads it when the ring looks full/empty.
+template <typename T, std::size_t N>
+class spsc_ring
+{
+    static_assert(N != 0 && (N & (N - 1)) == 0, "spsc_ring capacity must be a power of two");
+
+public:
+    using value_type = T;
+
+    spsc_ring() = default;
+    spsc_ring(const spsc_ring&) = delete;
+    spsc_ring& operator=(const spsc_ring&) = delete;
+
+    bool try_push(const value_type& elem)
+    {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_cachedHead == N)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if (tail - m_cachedHead == N)
+            {
+                return false;
+            }
+        }
+
+        m_buffer[tail & mask] = elem;
+        m_tail.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    bool try_push(value_type&& elem)
+    {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_cachedHead == N)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if (tail - m_cachedHead == N)
+            {
+                return false;
+            }
+        }
+
+        m_buffer[tail & mask] = std::move(elem);
+        m_tail.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    bool try_pop(value_type& out)
+    {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_cachedTail)
+        {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if (head == m_cachedTail)
+            {
+                return false;
+            }
+        }
+
+        out = std::move(m_buffer[head & mask]);
+        m_head.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    // Pushes up to count elements with at most two contiguous copies and a single publish.
+    // Returns the number of elements actually pushed.
+    std::size_t push_n(const value_type* elems, std::size_t count)
+    {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (N - (tail - m_cachedHead) < count)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+        }
+
+        const std::size_t pushed = std::min(count, N - (tail - m_cachedHead));
+        if (pushed == 0)
+        {
+            return 0;
+        }
+
+        const std::size_t offset = tail & mask;
+        const std::size_t firstPart = std::min(pushed, N - offset);
+        std::copy_n(elems, firstPart, m_buffer.data() + offset);
+        std::copy_n(elems + firstPart, pushed - firstPart, m_buffer.data());
+        m_tail.store(tail + pushed, std::memory_order_release);
+
+        return pushed;
+    }
+
+    // Pops up to count elements into out. Returns the number of elements actually popped.
+    std::size_t pop_n(value_type* out, std::size_t count)
+    {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (m_cachedTail - head < count)
+        {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+        }
+
+        const std::size_t popped = std::min(count, m_cachedTail - head);
+        if (popped == 0)
+        {
+            return 0;
+        }
+
+        const std::size_t offset = head & mask;
+        const std::size_t firstPart = std::min(popped, N - offset);
+        std::move(m_buffer.data() + offset, m_buffer.data() + offset + firstPart, out);
+        std::move(m_buffer.data(), m_buffer.data() + popped - firstPart, out + firstPart);
+        m_head.store(head + popped, std::memory_order_release);
+
+        return popped;
+    }
+
+    // Exact only when called from the producer or consumer thread while the other is idle.
+    std::size_t size() const noexcept
+    {
+        return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+    }
+
+    bool is_empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    static constexpr std::size_t capacity() noexcept
+    {
+        return N;
+    }
+
+private:
+    static constexpr std::size_t mask = N - 1;
+
+    alignas(cache_line_size) std::atomic<std::size_t> m_head{ 0 };
+    std::size_t m_cachedTail = 0;
+
+    alignas(cache_line_size) std::atomic<std::size_t> m_tail{ 0 };
+    std::size_t m_cachedHead = 0;
+
+    alignas(cache_line_size) my_array<value_type, N> m_buffer{};
+};
+
+#endif
@@ -0,0 +1,191 @@
+#ifndef STRIDED_VIEW_H
+#define STRIDED_VIEW_H
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "my_span.h"
+
+// Non-owning view of every stride-th element, e.g. one column of a row-major matrix.
+template <typename T>
+class strided_view
+{
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+
+    // Keeps the base pointer and an element index, so end() never forms a pointer past the buffer.
+    class iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::remove_cv_t<T>;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator() = default;
+
+        iterator(pointer base, difference_type index, difference_type stride) :
+            m_base(base),
+            m_index(index),
+            m_stride(stride)
+        {
+        }
+
+        reference operator*() const { return m_base[m_index * m_stride]; }
+        pointer operator->() const { return m_base + m_index * m_stride; }
+
+        iterator& operator++()
+        {
+            ++m_index;
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            return iterator(m_base, m_index++, m_stride);
+        }
+
+        iterator& operator--()
+        {
+            --m_index;
+            return *this;
+        }
+
+        iterator operator--(int)
+        {
+            return iterator(m_base, m_index--, m_stride);
+        }
+
+        iterator& operator+=(difference_type offset)
+        {
+            m_index += offset;
+            return *this;
+        }
+
+        iterator operator+(difference_type offset) const
+        {
+            return iterator(m_base, m_index + offset, m_stride);
+        }
+
+        friend iterator operator+(difference_type offset, const iterator& it)
+        {
+            return it + offset;
+        }
+
+        iterator& operator-=(difference_type offset)
+        {
+            m_index -= offset;
+            return *this;
+        }
+
+        iterator operator-(difference_type offset) const
+        {
+            return iterator(m_base, m_index - offset, m_stride);
+        }
+
+        difference_type operator-(const iterator& other) const
+        {
+            return m_index - other.m_index;
+        }
+
+        reference operator[](difference_type index) const
+        {
+            return m_base[(m_index + index) * m_stride];
+        }
+
+        bool operator==(const iterator& other) const
+        {
+            return m_index == other.m_index;
+        }
+
+        auto operator<=>(const iterator& other) const
+        {
+            return m_index <=> other.m_index;
+        }
+
+    private:
+        pointer m_base = nullptr;
+        difference_type m_index = 0;
+        difference_type m_stride = 1;
+    };
+
+    strided_view() = default;
+
+    strided_view(T* data, std::size_t count, std::ptrdiff_t stride) :
+        m_data(data),
+        m_size(count),
+        m_stride(stride)
+    {
+    }
+
+    // Every stride-th element of the span, starting from its first element. stride must not be 0.
+    template <std::size_t Extent>
+    strided_view(my_span<T, Extent> span, std::size_t stride) :
+        m_data(span.data()),
+        m_size(strided_count(span.size(), stride)),
+        m_stride(static_cast<std::ptrdiff_t>(stride))
+    {
+    }
+
+    T& operator[](std::size_t i) const
+    {
+        return m_data[static_cast<std::ptrdiff_t>(i) * m_stride];
+    }
+
+    T& front() const
+    {
+        return m_data[0];
+    }
+
+    T& back() const
+    {
+        return (*this)[m_size - 1];
+    }
+
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    std::ptrdiff_t stride() const noexcept
+    {
+        return m_stride;
+    }
+
+    bool is_empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    iterator begin() const
+    {
+        return iterator(m_data, 0, m_stride);
+    }
+
+    iterator end() const
+    {
+        return iterator(m_data, static_cast<std::ptrdiff_t>(m_size), m_stride);
+    }
+
+    // Elements [offset, offset + count * step) of this view, taking every step-th one.
+    strided_view slice(std::size_t offset, std::size_t count, std::ptrdiff_t step = 1) const
+    {
+        return strided_view(m_data + static_cast<std::ptrdiff_t>(offset) * m_stride, count, m_stride * step);
+    }
+
+private:
+    static std::size_t strided_count(std::size_t count, std::size_t stride)
+    {
+        MY_VECTOR_HARDENED_CHECK(stride != 0, "strided_view stride of 0");
+        return count == 0 ? 0 : (count - 1) / stride + 1;
+    }
+
+    T* m_data = nullptr;
+    std::size_t m_size = 0;
+    std::ptrdiff_t m_stride = 1;
+};
+
+#endif
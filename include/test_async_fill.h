@@ -0,0 +1,203 @@
+#ifndef TEST_ASYNC_FILL_H
+#define TEST_ASYNC_FILL_H
+
+#include <string>
+#include <cassert>
+#include <cerrno>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+
+#include <unistd.h>
+
+#include "async_fill.h"
+#include "my_vector.h"
+
+// A file in /tmp holding the given bytes, removed again when this goes.
+class temp_file
+{
+public:
+    explicit temp_file(const std::string& contents)
+    {
+        const int fd = mkstemp(m_path);
+        assert(fd >= 0);
+        [[maybe_unused]] const ssize_t written = write(fd, contents.data(), contents.size());
+        assert(written == static_cast<ssize_t>(contents.size()));
+        close(fd);
+    }
+
+    temp_file(const temp_file&) = delete;
+    temp_file& operator=(const temp_file&) = delete;
+
+    ~temp_file()
+    {
+        unlink(m_path);
+    }
+
+    const char* path() const
+    {
+        return m_path;
+    }
+
+private:
+    char m_path[32] = "/tmp/async_fill_XXXXXX";
+};
+
+// One number per line; a last line without its newline only counts at the end.
+inline std::size_t parse_lines(my_vector<long>& vec, my_span<const char> bytes, bool atEnd)
+{
+    const char* const begin = bytes.data();
+    const char* const end = begin + bytes.size();
+    const char* line = begin;
+    for (const char* it = begin; it != end; ++it)
+    {
+        if (*it == '\n')
+        {
+            long value = 0;
+            std::from_chars(line, it, value);
+            vec.push_back(value);
+            line = it + 1;
+        }
+    }
+    if (atEnd && line != end)
+    {
+        long value = 0;
+        std::from_chars(line, end, value);
+        vec.push_back(value);
+        line = end;
+    }
+    return static_cast<std::size_t>(line - begin);
+}
+
+// Named rather than lambdas, which GCC warns about inside a coroutine frame in a header.
+struct never_called_parser
+{
+    bool& called;
+
+    std::size_t operator()(my_vector<long>&, my_span<const char>, bool) const
+    {
+        called = true;
+        return 0;
+    }
+};
+
+struct failing_parser
+{
+    int& calls;
+
+    std::size_t operator()(my_vector<long>& vec, my_span<const char> bytes, bool atEnd) const
+    {
+        if (++calls == 10)
+        {
+            throw std::runtime_error("bad record");
+        }
+        return parse_lines(vec, bytes, atEnd);
+    }
+};
+
+void test_async_fill()
+{
+    my_vector<long> expected;
+    std::string text;
+    for (long i = 0; i < 5000; ++i)
+    {
+        // Every 1000th line is longer than a chunk.
+        const long value = i % 1000 == 999 ? 1 : i * 7919 % 100003;
+        expected.push_back(value);
+        text += (i % 1000 == 999 ? std::string(100, '0') : std::string()) + std::to_string(value) + '\n';
+    }
+    text += "42";
+    expected.push_back(42);
+    const temp_file lines(text);
+
+    my_vector<std::int32_t> numbers;
+    for (std::int32_t i = 0; i < 10000; ++i)
+    {
+        numbers.push_back(i * 31 - 5000);
+    }
+    const temp_file raw(std::string(reinterpret_cast<const char*>(numbers.data()), numbers.size() * sizeof(std::int32_t)));
+    const temp_file empty("");
+
+    for (const read_backend backend : { read_backend::automatic, read_backend::thread_pool })
+    {
+        // test parsing lines split across small chunks, and records longer than a chunk
+        {
+            file_source source(lines.path(), 64, 3, backend);
+            assert(source.backend() != read_backend::automatic);
+            assert(source.size() == text.size());
+            my_vector<long> vec;
+            async_fill(vec, source, parse_lines).get();
+            assert(vec == expected);
+            assert(vec.capacity() >= vec.size());
+        }
+
+        // test appending raw elements that straddle chunk boundaries, after what is there
+        {
+            file_source source(raw.path(), 1000, 1, backend);
+            my_vector<std::int32_t> vec{ 7 };
+            fill_task task = async_fill(vec, source);
+            assert(!task.is_done() && vec.size() == 1);
+            task.get();
+            assert(task.is_done());
+            assert(vec.size() == numbers.size() + 1 && vec.capacity() == vec.size());
+            assert(vec[0] == 7 && vec[1] == numbers[0] && vec.back() == numbers.back());
+            for (std::size_t i = 0; i < numbers.size(); ++i)
+            {
+                assert(vec[i + 1] == numbers[i]);
+            }
+        }
+
+        // test an empty file never calls the parser
+        {
+            file_source source(empty.path(), 64, 2, backend);
+            my_vector<long> vec{ 1 };
+            bool called = false;
+            async_fill(vec, source, never_called_parser{ called }).get();
+            assert(!called && vec.size() == 1);
+        }
+
+        // test an error from the parser ends the load and comes out of get()
+        {
+            file_source source(lines.path(), 64, 2, backend);
+            my_vector<long> vec;
+            int calls = 0;
+            fill_task task = async_fill(vec, source, failing_parser{ calls });
+            bool thrown = false;
+            try
+            {
+                task.get();
+            }
+            catch (const std::runtime_error&)
+            {
+                thrown = true;
+            }
+            assert(thrown && calls == 10 && task.is_done());
+        }
+    }
+
+    // test a missing file and a bad chunk size
+    int error = 0;
+    try
+    {
+        file_source missing("/tmp/async_fill_missing/none");
+    }
+    catch (const async_fill_error& e)
+    {
+        error = e.error();
+    }
+    assert(error == ENOENT);
+    error = 0;
+    try
+    {
+        file_source zero(lines.path(), 0);
+    }
+    catch (const async_fill_error& e)
+    {
+        error = e.error();
+    }
+    assert(error == EINVAL);
+}
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef TEST_COW_VECTOR_H
+#define TEST_COW_VECTOR_H
+
+#include <string>
+#include <cassert>
+#include <thread>
+#include <utility>
+
+#include "cow_vector.h"
+
+void test_cow_vector()
+{
+    // test copies share the buffer until the first mutation
+    cow_vector<std::string> original{ "a", "b", "c" };
+    cow_vector<std::string> copy = original;
+    assert(copy.use_count() == 2);
+    assert(std::as_const(copy).data() == std::as_const(original).data());
+    assert(copy == original);
+
+    const cow_vector<std::string>& constCopy = copy;
+    assert(constCopy[1] == "b");
+    assert(copy.is_shared());
+
+    copy.push_back("d");
+    assert(!copy.is_shared());
+    assert(!original.is_shared());
+    assert(original.size() == 3);
+    assert(copy.size() == 4);
+    assert(copy.back() == "d");
+
+    cow_vector<std::string> third = original;
+    third[0] = "z";
+    assert(original[0] == "a");
+    assert(third[0] == "z");
+
+    // test the remaining mutators detach as well
+    cow_vector<int> numbers(my_vector<int>{ 1, 2, 3, 4, 5 });
+    cow_vector<int> snapshot = numbers;
+    numbers.erase(1, 3);
+    assert((numbers.view() == my_vector<int>{ 1, 4, 5 }));
+    numbers.insert(0, 0);
+    assert((numbers.view() == my_vector<int>{ 0, 1, 4, 5 }));
+    numbers.resize(2);
+    for (int& i : numbers)
+    {
+        i *= 10;
+    }
+    assert((numbers.view() == my_vector<int>{ 0, 10 }));
+    assert((snapshot.view() == my_vector<int>{ 1, 2, 3, 4, 5 }));
+
+    cow_vector<int> unshared = snapshot;
+    unshared.unshare();
+    assert(unshared.use_count() == 1);
+    assert(unshared.data() != std::as_const(snapshot).data());
+    assert(unshared == snapshot);
+
+    snapshot.clear();
+    assert(snapshot.is_empty());
+    assert(snapshot.use_count() == 0);
+    snapshot.push_back(7);
+    assert(snapshot[0] == 7);
+
+    // test a reference handed out before a copy does not write into the copy
+    cow_vector<int> leaked{ 1, 2, 3 };
+    int& first = leaked[0];
+    int* const buffer = leaked.data();
+    cow_vector<int> later = leaked;
+    first = 5;
+    buffer[1] = 6;
+    assert((later.view() == my_vector<int>{ 1, 2, 3 }));
+    assert((leaked.view() == my_vector<int>{ 5, 6, 3 }));
+    assert(!leaked.is_shared() && !later.is_shared());
+
+    // test a buffer that handed out nothing, or was dropped since, is shared again
+    cow_vector<int> grown;
+    grown.push_back(1);
+    cow_vector<int> sharing = grown;
+    assert(sharing.use_count() == 2);
+    leaked.clear();
+    leaked.push_back(1);
+    sharing = leaked;
+    assert(sharing.use_count() == 2);
+
+    // test handing copies to several threads that each mutate their own copy
+    my_vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([copy = original, t]() mutable
+        {
+            for (int i = 0; i < 1000; ++i)
+            {
+                cow_vector<std::string> local = copy;
+                local.push_back(std::to_string(t));
+                assert(local.size() == 4);
+            }
+            copy[0] = std::to_string(t);
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    assert(original[0] == "a");
+    assert(original.use_count() == 1);
+}
+
+#endif
@@ -0,0 +1,205 @@
+#ifndef TEST_DEVECTOR_H
+#define TEST_DEVECTOR_H
+
+#include <string>
+#include <cassert>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <utility>
+
+#include "devector.h"
+
+void test_devector()
+{
+    // test push and pop at both ends
+    devector<int> dv;
+    assert(dv.is_empty());
+    for (int i = 0; i < 100; ++i)
+    {
+        dv.push_front(-i);
+        dv.push_back(i);
+    }
+    assert(dv.size() == 200);
+    assert(dv.front() == -99);
+    assert(dv.back() == 99);
+    for (std::size_t i = 0; i < dv.size(); ++i)
+    {
+        assert(dv[i] == static_cast<int>(i) - (i < 100 ? 99 : 100));
+    }
+
+    dv.pop_front();
+    dv.pop_back();
+    assert(dv.front() == -98);
+    assert(dv.back() == 98);
+    assert(dv.size() == 198);
+
+    // test contiguous iterators and data()
+    static_assert(std::contiguous_iterator<devector<int>::iterator>);
+    assert(std::to_address(dv.begin()) == dv.data());
+    assert(std::distance(dv.begin(), dv.end()) == 198);
+    assert(*dv.rbegin() == 98);
+    assert(*std::prev(dv.rend()) == -98);
+
+    // test front pushes only move the elements O(log n) times
+    devector<int> front;
+    const int* lastData = nullptr;
+    int moves = 0;
+    for (int i = 0; i < 1 << 16; ++i)
+    {
+        front.push_front(i);
+        if (front.data() + 1 != lastData && lastData != nullptr)
+        {
+            ++moves;
+        }
+        lastData = front.data();
+    }
+    assert(moves <= 20);
+    assert(front.front() == (1 << 16) - 1);
+    assert(front.back() == 0);
+
+    // test a FIFO queue re-centers in place instead of growing
+    devector<int> queue;
+    for (int i = 0; i < 8; ++i)
+    {
+        queue.push_back(i);
+    }
+    std::size_t queueCapacity = 0;
+    for (int i = 8; i < 10000; ++i)
+    {
+        queue.push_back(i);
+        assert(queue.front() == i - 8);
+        queue.pop_front();
+        if (i == 100)
+        {
+            queueCapacity = queue.capacity();
+        }
+    }
+    assert(queue.capacity() == queueCapacity);
+    assert(queueCapacity <= 32);
+    assert(queue.size() == 8);
+    assert(queue.front() == 9992);
+
+    // test emptying re-centers and clear keeps the buffer
+    devector<std::string> strings{ "a", "b", "c" };
+    strings.reserve_front(10);
+    assert(strings.front_free_capacity() >= 7);
+    assert(strings.size() == 3);
+    assert(strings[0] == "a");
+    strings.reserve_back(20);
+    assert(strings.back_free_capacity() >= 17);
+    const std::size_t stringsCapacity = strings.capacity();
+    strings.clear();
+    assert(strings.is_empty());
+    assert(strings.capacity() == stringsCapacity);
+    assert(strings.front_free_capacity() == stringsCapacity / 2);
+    strings.shrink_to_fit();
+    assert(strings.capacity() == 0);
+
+    // test insert and erase in the middle shift the shorter side
+    devector<std::string> words{ "a", "b", "c", "d", "e", "f" };
+    auto it = words.insert(words.cbegin() + 1, "x");
+    assert(*it == "x");
+    it = words.insert(words.cend() - 1, "y");
+    assert(*it == "y");
+    assert((words == devector<std::string>{ "a", "x", "b", "c", "d", "e", "y", "f" }));
+
+    it = words.erase(words.cbegin() + 1);
+    assert(*it == "b");
+    it = words.erase(words.cbegin() + 5);
+    assert(*it == "f");
+    assert((words == devector<std::string>{ "a", "b", "c", "d", "e", "f" }));
+
+    const my_vector<std::string> extra{ "p", "q", "r" };
+    it = words.insert(words.cbegin() + 1, extra.cbegin(), extra.cend());
+    assert(*it == "p");
+    it = words.insert(words.cbegin() + 8, extra.cbegin(), extra.cend());
+    assert(*it == "p");
+    assert((words == devector<std::string>{ "a", "p", "q", "r", "b", "c", "d", "e", "p", "q", "r", "f" }));
+    it = words.erase(words.cbegin() + 1, words.cbegin() + 4);
+    assert(*it == "b");
+    it = words.erase(words.cbegin() + 5, words.cend() - 1);
+    assert(*it == "f");
+    assert((words == devector<std::string>{ "a", "b", "c", "d", "e", "f" }));
+    assert(words < (devector<std::string>{ "a", "c" }));
+
+    // test arguments that alias an element survive the growth that moves it
+    devector<std::string> aliasing{ "first" };
+    aliasing.shrink_to_fit();
+    aliasing.push_front(aliasing.back());
+    aliasing.push_back(aliasing.front());
+    aliasing.emplace_back(aliasing[1]);
+    assert((aliasing == devector<std::string>{ "first", "first", "first", "first" }));
+
+    // test resize, at and copies
+    devector<int> sized(3, 7);
+    sized.resize(5);
+    assert((sized == devector<int>{ 7, 7, 7, 0, 0 }));
+    sized.resize(2);
+    assert((sized == devector<int>{ 7, 7 }));
+    sized.resize(4, sized[0]);
+    assert((sized == devector<int>{ 7, 7, 7, 7 }));
+    bool thrown = false;
+    try
+    {
+        sized.at(4);
+    }
+    catch (const my_vector_out_of_range&)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+
+    devector<int> copy = sized;
+    copy.push_front(1);
+    assert(sized.size() == 4);
+    devector<int> moved = std::move(copy);
+    assert(copy.is_empty());
+    assert(moved.front() == 1);
+    moved = sized;
+    assert(moved == sized);
+
+    // test against std::deque under a mixed sequence of operations
+    devector<std::unique_ptr<int>> owners;
+    std::deque<int> reference;
+    std::mt19937 gen(12345);
+    std::uniform_int_distribution<int> opDist(0, 5);
+    for (int i = 0; i < 20000; ++i)
+    {
+        const int op = opDist(gen);
+        if (op == 0 || reference.empty())
+        {
+            owners.push_front(std::make_unique<int>(i));
+            reference.push_front(i);
+        }
+        else if (op == 1 || op == 2)
+        {
+            owners.push_back(std::make_unique<int>(i));
+            reference.push_back(i);
+        }
+        else if (op == 3)
+        {
+            owners.pop_front();
+            reference.pop_front();
+        }
+        else if (op == 4)
+        {
+            owners.pop_back();
+            reference.pop_back();
+        }
+        else
+        {
+            const std::ptrdiff_t pos = std::uniform_int_distribution<std::ptrdiff_t>(0, static_cast<std::ptrdiff_t>(reference.size()))(gen);
+            owners.insert(owners.cbegin() + pos, std::make_unique<int>(i));
+            reference.insert(reference.begin() + pos, i);
+        }
+    }
+    assert(owners.size() == reference.size());
+    for (std::size_t i = 0; i < reference.size(); ++i)
+    {
+        assert(*owners[i] == reference[i]);
+    }
+}
+
+#endif
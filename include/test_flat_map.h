@@ -0,0 +1,119 @@
+#ifndef TEST_FLAT_MAP_H
+#define TEST_FLAT_MAP_H
+
+#include <string>
+#include <cassert>
+#include <map>
+#include <random>
+#include <utility>
+
+#include "flat_map.h"
+
+template <typename Search>
+void test_flat_map_against_std_map()
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 500);
+
+    flat_map<int, int, std::less<int>, Search> map;
+    std::map<int, int> reference;
+    for (int round = 0; round < 20; ++round)
+    {
+        my_vector<std::pair<int, int>> batch;
+        for (int i = 0; i < 50; ++i)
+        {
+            batch.push_back({ dist(gen), i });
+        }
+        map.insert_range(batch.begin(), batch.end());
+        reference.insert(batch.begin(), batch.end());
+
+        const int key = dist(gen);
+        map.erase(key);
+        reference.erase(key);
+    }
+
+    assert(map.size() == reference.size());
+    for (int key = -1; key <= 501; ++key)
+    {
+        const auto it = reference.find(key);
+        assert(map.contains(key) == (it != reference.end()));
+        if (it != reference.end())
+        {
+            assert(map.at(key) == it->second);
+        }
+        assert(map.lower_bound(key) == static_cast<std::size_t>(std::distance(reference.begin(), reference.lower_bound(key))));
+    }
+}
+
+void test_flat_map()
+{
+    // test construction and lookup
+    flat_map<std::string, int> map{ { "b", 2 }, { "a", 1 }, { "c", 3 }, { "a", 42 } };
+    assert(map.size() == 3);
+    assert((map.keys() == my_vector<std::string>{ "a", "b", "c" }));
+    assert((map.values() == my_vector<int>{ 1, 2, 3 }));
+    assert(map.at("b") == 2);
+    assert(map.contains("c"));
+    assert(!map.contains("d"));
+    assert(map.find("d") == nullptr);
+    *map.find("c") = 30;
+    assert(map.at("c") == 30);
+
+    bool caughtError = false;
+    try
+    {
+        map.at("d");
+    }
+    catch (const flat_map_out_of_range&)
+    {
+        caughtError = true;
+    }
+    assert(caughtError);
+
+    // test insert/erase
+    assert(map.insert("d", 4).second);
+    assert(!map.insert("d", 5).second);
+    assert(map.at("d") == 4);
+    assert(map.insert_or_assign("d", 5).first == 3);
+    assert(map.at("d") == 5);
+    map["e"] += 6;
+    assert(map.at("e") == 6);
+    assert(map.erase("a") == 1);
+    assert(map.erase("a") == 0);
+    assert((map.keys() == my_vector<std::string>{ "b", "c", "d", "e" }));
+
+    // test batched insertion keeps existing values and the first duplicate of the batch
+    my_vector<std::pair<std::string, int>> batch{ { "z", 26 }, { "b", 0 }, { "f", 6 }, { "f", 7 }, { "a", 1 } };
+    map.insert_range(batch.begin(), batch.end());
+    assert((map.keys() == my_vector<std::string>{ "a", "b", "c", "d", "e", "f", "z" }));
+    assert((map.values() == my_vector<int>{ 1, 2, 30, 5, 6, 6, 26 }));
+
+    // test bulk sorted construction
+    const flat_map<int, std::string, std::less<int>, eytzinger_search<int>> sortedMap(
+        sorted_unique, my_vector<int>{ 1, 3, 5, 7, 9, 11 }, my_vector<std::string>{ "1", "3", "5", "7", "9", "11" });
+    assert(sortedMap.at(7) == "7");
+    assert(sortedMap.lower_bound(0) == 0);
+    assert(sortedMap.lower_bound(4) == 2);
+    assert(sortedMap.lower_bound(11) == 5);
+    assert(sortedMap.lower_bound(12) == 6);
+    assert(!sortedMap.contains(8));
+    bool thrown = false;
+    try
+    {
+        flat_map<int, int>(sorted_unique, my_vector<int>{ 1, 2, 3 }, my_vector<int>{ 1, 2 });
+    }
+    catch (const flat_map_size_mismatch&)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+
+    map.clear();
+    assert(map.is_empty());
+    assert(!map.contains("a"));
+
+    test_flat_map_against_std_map<branchless_search<int>>();
+    test_flat_map_against_std_map<eytzinger_search<int>>();
+}
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef TEST_FLAT_SET_H
+#define TEST_FLAT_SET_H
+
+#include <string>
+#include <cassert>
+#include <set>
+#include <random>
+#include <algorithm>
+
+#include "flat_set.h"
+
+template <typename Search>
+void test_flat_set_against_std_set()
+{
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> dist(0, 300);
+
+    flat_set<int, std::less<int>, Search> set;
+    std::set<int> reference;
+    for (int round = 0; round < 20; ++round)
+    {
+        my_vector<int> batch;
+        for (int i = 0; i < 30; ++i)
+        {
+            batch.push_back(dist(gen));
+        }
+        set.insert_range(batch.begin(), batch.end());
+        reference.insert(batch.begin(), batch.end());
+
+        const int key = dist(gen);
+        assert(set.erase(key) == reference.erase(key));
+        set.insert(key + 1);
+        reference.insert(key + 1);
+    }
+
+    assert(set.size() == reference.size());
+    assert(std::equal(set.begin(), set.end(), reference.begin(), reference.end()));
+    for (int key = -1; key <= 302; ++key)
+    {
+        assert(set.contains(key) == reference.contains(key));
+    }
+}
+
+void test_flat_set()
+{
+    flat_set<std::string> set{ "delta", "alpha", "charlie", "alpha" };
+    assert(set.size() == 3);
+    assert((set.keys() == my_vector<std::string>{ "alpha", "charlie", "delta" }));
+    assert(set.contains("alpha"));
+    assert(!set.contains("bravo"));
+    assert(set.insert("bravo").first == 1);
+    assert(!set.insert("bravo").second);
+    assert(set.erase("charlie") == 1);
+    assert(set.erase("charlie") == 0);
+
+    std::string joined;
+    for (const std::string& key : set)
+    {
+        joined += key[0];
+    }
+    assert(joined == "abd");
+
+    const flat_set<int, std::less<int>, eytzinger_search<int>> sortedSet(sorted_unique, my_vector<int>{ 2, 4, 6, 8, 10, 12, 14 });
+    for (int key = 0; key < 16; ++key)
+    {
+        assert(sortedSet.contains(key) == (key != 0 && key % 2 == 0 && key <= 14));
+        const auto expected = std::lower_bound(sortedSet.begin(), sortedSet.end(), key) - sortedSet.begin();
+        assert(sortedSet.lower_bound(key) == static_cast<std::size_t>(expected));
+    }
+
+    set.clear();
+    assert(set.is_empty());
+
+    test_flat_set_against_std_set<branchless_search<int>>();
+    test_flat_set_against_std_set<eytzinger_search<int>>();
+}
+
+#endif
@@ -0,0 +1,141 @@
+#ifndef TEST_GAP_VECTOR_H
+#define TEST_GAP_VECTOR_H
+
+#include <string>
+#include <cassert>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "gap_vector.h"
+
+void test_gap_vector()
+{
+    // test typing at a cursor in the middle
+    const std::u32string original = U"hello world";
+    gap_vector<char32_t> text(original.begin(), original.end());
+    assert(text.size() == 11);
+    std::size_t cursor = 5;
+    for (const char32_t c : std::u32string(U", dear"))
+    {
+        text.insert(text.cbegin() + cursor++, c);
+    }
+    assert(text.gap_position() == cursor);
+    my_span<char32_t> flat = text.flatten();
+    assert(std::u32string(flat.begin(), flat.end()) == U"hello, dear world");
+    assert(text.gap_position() == text.size());
+
+    // test backspace at the cursor leaves the gap in place
+    cursor = 11;
+    text.insert(text.cbegin() + cursor, U'!');
+    const std::size_t gapBefore = text.gap_position();
+    text.erase(text.cbegin() + gapBefore - 1);
+    text.erase(text.cbegin() + gapBefore - 2);
+    assert(text.gap_position() == gapBefore - 2);
+    flat = text.flatten();
+    assert(std::u32string(flat.begin(), flat.end()) == U"hello, dea world");
+
+    // test iterators step over the gap
+    static_assert(std::random_access_iterator<gap_vector<char32_t>::iterator>);
+    static_assert(std::random_access_iterator<gap_vector<char32_t>::const_iterator>);
+    text.insert(text.cbegin() + 3, U'_');
+    assert(text.gap_size() != 0);
+    assert(std::u32string(text.begin(), text.end()) == U"hel_lo, dea world");
+    assert(text.cbegin()[4] == U'l');
+    assert(*(text.end() - 1) == U'd');
+    assert(std::distance(text.begin(), text.end()) == 17);
+    assert(text.front() == U'h');
+    assert(text.back() == U'd');
+    assert(text.at(3) == U'_');
+
+    // test range edits
+    gap_vector<std::string> words{ "a", "b", "c", "d" };
+    const my_vector<std::string> extra{ "x", "y" };
+    auto it = words.insert(words.cbegin() + 1, extra.cbegin(), extra.cend());
+    assert(*it == "x");
+    assert((words == gap_vector<std::string>{ "a", "x", "y", "b", "c", "d" }));
+    it = words.erase(words.cbegin() + 4, words.cend());
+    assert(it == words.end());
+    it = words.erase(words.cbegin(), words.cbegin() + 2);
+    assert(*it == "y");
+    assert((words == gap_vector<std::string>{ "y", "b" }));
+    words.push_back("z");
+    words.pop_back();
+    words.push_back("c");
+    assert((words == gap_vector<std::string>{ "y", "b", "c" }));
+    assert(words < (gap_vector<std::string>{ "z" }));
+
+    // test arguments that alias an element survive the gap moving
+    words.insert(words.cbegin(), words.back());
+    words.insert(words.cend(), words.front());
+    assert((words == gap_vector<std::string>{ "c", "y", "b", "c", "c" }));
+
+    // test copies, moves and shrinking
+    gap_vector<std::string> copy = words;
+    copy.erase(copy.cbegin() + 1);
+    assert(words.size() == 5);
+    gap_vector<std::string> moved = std::move(copy);
+    assert(copy.is_empty());
+    assert(moved.size() == 4);
+    moved.shrink_to_fit();
+    assert(moved.gap_size() == 0);
+    assert(moved.capacity() == 4);
+    assert((moved == gap_vector<std::string>{ "c", "b", "c", "c" }));
+    moved = words;
+    assert(moved == words);
+    moved.clear();
+    assert(moved.is_empty());
+    bool thrown = false;
+    try
+    {
+        moved.at(0);
+    }
+    catch (const my_vector_out_of_range&)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // test against std::vector under random cursor edits
+    gap_vector<std::unique_ptr<int>> owners;
+    std::vector<int> reference;
+    std::mt19937 gen(4242);
+    std::uniform_int_distribution<int> opDist(0, 7);
+    std::size_t position = 0;
+    for (int i = 0; i < 20000; ++i)
+    {
+        const int op = opDist(gen);
+        if (op == 0)
+        {
+            position = std::uniform_int_distribution<std::size_t>(0, reference.size())(gen);
+        }
+        else if (op <= 4 || reference.empty())
+        {
+            owners.insert(owners.cbegin() + position, std::make_unique<int>(i));
+            reference.insert(reference.begin() + position, i);
+            ++position;
+        }
+        else if (position > 0)
+        {
+            owners.erase(owners.cbegin() + position - 1);
+            reference.erase(reference.begin() + position - 1);
+            --position;
+        }
+        position = std::min(position, reference.size());
+    }
+    assert(owners.size() == reference.size());
+    for (std::size_t i = 0; i < reference.size(); ++i)
+    {
+        assert(*owners[i] == reference[i]);
+    }
+    const my_span<std::unique_ptr<int>> flatOwners = owners.flatten();
+    for (std::size_t i = 0; i < reference.size(); ++i)
+    {
+        assert(*flatOwners[i] == reference[i]);
+    }
+}
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef TEST_GATHER_SCATTER_H
+#define TEST_GATHER_SCATTER_H
+
+#include <string>
+#include <cassert>
+#include <cstdint>
+#include <random>
+
+#include "gather_scatter.h"
+#include "my_array.h"
+#include "my_span.h"
+#include "my_vector.h"
+
+template <typename T, typename Index>
+void test_gather_against_loop(std::size_t tableSize, std::size_t count, std::size_t distance, std::mt19937& gen)
+{
+    my_vector<T> table;
+    for (std::size_t i = 0; i < tableSize; ++i)
+    {
+        table.push_back(static_cast<T>(i * 3 + 1));
+    }
+    my_vector<Index> indices;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        indices.push_back(static_cast<Index>(gen() % tableSize));
+    }
+
+    my_vector<T> out(count, T{});
+    gather(table, indices, out, distance);
+    my_vector<T> simdOut(count, T{});
+    gather_simd(table, indices, simdOut, distance);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        assert(out[i] == table[indices[i]]);
+    }
+    assert(simdOut == out);
+}
+
+void test_gather_scatter()
+{
+    std::mt19937 gen(17);
+
+    // test gather on every vector path and the scalar tail
+    for (std::size_t count : { 0, 1, 7, 8, 15, 16, 17, 100, 1000 })
+    {
+        test_gather_against_loop<float, std::uint32_t>(1000, count, default_prefetch_distance, gen);
+        test_gather_against_loop<std::int32_t, std::int32_t>(64, count, 0, gen);
+        test_gather_against_loop<double, std::uint32_t>(5000, count, 4, gen);
+        test_gather_against_loop<std::uint64_t, std::uint32_t>(3, count, default_prefetch_distance, gen);
+        test_gather_against_loop<std::uint16_t, std::uint64_t>(1000, count, default_prefetch_distance, gen);
+    }
+
+    // test non-trivial elements and other contiguous ranges
+    const my_array<std::string, 3> words{ "zero", "one", "two" };
+    const my_vector<std::uint8_t> wordIndices{ 2, 0, 2, 1 };
+    my_vector<std::string> gathered(4, "");
+    gather(words, wordIndices, gathered);
+    assert((gathered == my_vector<std::string>{ "two", "zero", "two", "one" }));
+
+    my_array<int, 4> small{ 0, 0, 0, 0 };
+    const my_vector<int> smallIndices{ 3, 1 };
+    gather(my_vector<int>{ 10, 20, 30, 40 }, smallIndices, my_span(small).first(2));
+    assert(small[0] == 40 && small[1] == 20 && small[2] == 0);
+
+    bool thrown = false;
+    try
+    {
+        gather(words, wordIndices, my_span(gathered).first(3));
+    }
+    catch (const gather_scatter_size_mismatch&)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // test scatter: the last write to a slot wins
+    my_vector<int> table(6, 0);
+    const my_vector<std::uint32_t> indices{ 4, 1, 4, 0 };
+    scatter(table, indices, my_vector<int>{ 7, 8, 9, 10 });
+    assert((table == my_vector<int>{ 10, 8, 0, 0, 9, 0 }));
+
+    // test scatter_add accumulates repeated indices
+    scatter_add(table, indices, my_vector<int>{ 1, 1, 1, 1 });
+    assert((table == my_vector<int>{ 11, 9, 0, 0, 11, 0 }));
+
+    my_vector<double> histogram(8, 0.0);
+    my_vector<std::uint32_t> buckets;
+    my_vector<double> ones;
+    for (int i = 0; i < 1000; ++i)
+    {
+        buckets.push_back(static_cast<std::uint32_t>(i % 8));
+        ones.push_back(1.0);
+    }
+    scatter_add(histogram, buckets, ones, 3);
+    for (std::size_t i = 0; i < histogram.size(); ++i)
+    {
+        assert(histogram[i] == 125.0);
+    }
+}
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef TEST_HUGE_PAGE_STORAGE_H
+#define TEST_HUGE_PAGE_STORAGE_H
+
+#include <cassert>
+#include <cstdint>
+
+#include "my_vector.h"
+#include "huge_page_storage.h"
+
+void test_huge_page_storage()
+{
+    huge_page_counters& stats = huge_page_stats();
+    const std::size_t mappedBefore = stats.mappedAllocations;
+    const std::size_t liveBefore = stats.liveMappedBytes;
+
+    // test small buffers stay on the heap and large ones are mapped at huge page alignment
+    {
+        my_vector<float, alignof(float), huge_page_storage<huge_page_size>> table;
+        table.push_back(1.0f);
+        assert(stats.mappedAllocations == mappedBefore);
+
+        constexpr std::size_t count = (huge_page_size / sizeof(float)) * 3;
+        table.reserve(count);
+        assert(stats.mappedAllocations == mappedBefore + 1);
+        assert(stats.liveMappedBytes == liveBefore + 3 * huge_page_size);
+        assert(reinterpret_cast<std::uintptr_t>(table.data()) % huge_page_size == 0);
+
+        for (std::size_t i = 1; i < count; ++i)
+        {
+            table.push_back(static_cast<float>(i));
+        }
+        assert(table.size() == count);
+        assert(table[0] == 1.0f);
+        assert(table[count - 1] == static_cast<float>(count - 1));
+
+        table.push_back(0.0f);
+        assert(stats.mappedAllocations == mappedBefore + 2);
+        assert(stats.liveMappedBytes == liveBefore + 6 * huge_page_size);
+        assert(table[count - 1] == static_cast<float>(count - 1));
+    }
+    assert(stats.liveMappedBytes == liveBefore);
+
+    // test the explicit hugetlb path either gets reserved pages or falls back to THP
+    {
+        const std::size_t hugetlbBefore = stats.hugetlbAllocations + stats.hugetlbFailures;
+        my_vector<char, 1, huge_page_storage<huge_page_size, true>> buffer(huge_page_size, 'x');
+        assert(stats.hugetlbAllocations + stats.hugetlbFailures > hugetlbBefore);
+        assert(reinterpret_cast<std::uintptr_t>(buffer.data()) % huge_page_size == 0);
+        assert(buffer[huge_page_size - 1] == 'x');
+    }
+    assert(stats.liveMappedBytes == liveBefore);
+}
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef TEST_JAGGED_VECTOR_H
+#define TEST_JAGGED_VECTOR_H
+
+#include <string>
+#include <cassert>
+#include <cstdint>
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "jagged_vector.h"
+
+void test_jagged_vector()
+{
+    // test appending rows, including empty ones
+    jagged_vector<int> rows;
+    assert(rows.is_empty() && rows.offsets().is_empty());
+    rows.append_row({ 1, 2, 3 });
+    rows.append_row({});
+    const my_vector<int> third{ 4, 5 };
+    rows.append_row(third);
+    assert(rows.size() == 3);
+    assert(rows.value_count() == 5);
+    assert((rows.offsets() == my_vector<std::size_t>{ 0, 3, 3, 5 }));
+    assert(rows.row_size(1) == 0 && rows[1].is_empty());
+    assert(rows[2][1] == 5);
+    rows[0][0] = 10;
+    assert(rows.values()[0] == 10);
+    assert((rows == jagged_vector<int>{ { 10, 2, 3 }, {}, { 4, 5 } }));
+
+    // test rows iterate in order as spans
+    static_assert(std::forward_iterator<jagged_vector<int>::const_iterator>);
+    std::vector<std::size_t> sizes;
+    for (const my_span<const int> row : std::as_const(rows))
+    {
+        sizes.push_back(row.size());
+    }
+    assert((sizes == std::vector<std::size_t>{ 3, 0, 2 }));
+
+    // test popping rows and out-of-range access
+    rows.pop_row();
+    assert(rows.size() == 2 && rows.value_count() == 3);
+    rows.pop_row();
+    rows.pop_row();
+    assert(rows.is_empty() && rows.offsets().is_empty() && rows.values().is_empty());
+    bool thrown = false;
+    try
+    {
+        rows.at(0);
+    }
+    catch (const my_vector_out_of_range&)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // test appending a row of its own, as a span and as iterators, across reallocations
+    jagged_vector<std::string> doubled{ { "a", "bb" } };
+    for (int i = 0; i < 8; ++i)
+    {
+        doubled.append_row(doubled[doubled.size() - 1]);
+        doubled.append_row(doubled[0].begin(), doubled[0].end());
+    }
+    assert(doubled.size() == 17 && doubled.value_count() == 34);
+    for (const my_span<const std::string> row : doubled)
+    {
+        assert(row.size() == 2 && row[0] == "a" && row[1] == "bb");
+    }
+
+    // test building from unordered (row, value) pairs keeps each row's input order
+    const std::vector<std::pair<std::uint32_t, std::string>> pairs{
+        { 2, "c0" }, { 0, "a0" }, { 2, "c1" }, { 3, "d0" }, { 0, "a1" }, { 2, "c2" } };
+    const jagged_vector<std::string> built(from_row_value_pairs, 5, pairs.begin(), pairs.end());
+    assert(built.size() == 5);
+    assert((built == jagged_vector<std::string>{ { "a0", "a1" }, {}, { "c0", "c1", "c2" }, { "d0" }, {} }));
+
+    thrown = false;
+    try
+    {
+        jagged_vector<std::string>(from_row_value_pairs, 3, pairs.begin(), pairs.end());
+    }
+    catch (const my_vector_out_of_range&)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+    const jagged_vector<std::string> none(from_row_value_pairs, 0, pairs.end(), pairs.end());
+    assert(none.is_empty());
+
+    // test an adjacency list against my_vector<my_vector<>> with 32-bit offsets
+    const std::uint32_t vertices = 1000;
+    my_vector<my_vector<std::uint32_t>> nested(vertices, my_vector<std::uint32_t>{});
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> edges;
+    std::mt19937 gen(99);
+    std::uniform_int_distribution<std::uint32_t> vertexDist(0, vertices - 1);
+    for (int i = 0; i < 5000; ++i)
+    {
+        const std::uint32_t from = vertexDist(gen);
+        const std::uint32_t to = vertexDist(gen);
+        nested[from].push_back(to);
+        edges.emplace_back(from, to);
+    }
+    const jagged_vector<std::uint32_t, std::uint32_t> graph(from_row_value_pairs, vertices, edges.begin(), edges.end());
+    assert(graph.value_count() == edges.size());
+    std::size_t v = 0;
+    for (const my_span<const std::uint32_t> neighbours : graph)
+    {
+        assert(std::equal(neighbours.begin(), neighbours.end(), nested[v].begin(), nested[v].end()));
+        ++v;
+    }
+    assert(v == vertices);
+
+    jagged_vector<std::uint32_t, std::uint32_t> appended;
+    appended.reserve(vertices, edges.size());
+    for (const my_vector<std::uint32_t>& neighbours : nested)
+    {
+        appended.append_row(neighbours.begin(), neighbours.end());
+    }
+    assert(appended == graph);
+}
+
+#endif
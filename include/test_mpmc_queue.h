@@ -0,0 +1,81 @@
+#ifndef TEST_MPMC_QUEUE_H
+#define TEST_MPMC_QUEUE_H
+
+#include <string>
+#include <cassert>
+#include <cstdint>
+#include <atomic>
+#include <thread>
+
+#include "mpmc_queue.h"
+
+void test_mpmc_queue()
+{
+    // test single-threaded semantics
+    mpmc_queue<std::string> queue(3);
+    assert(queue.capacity() == 4);
+    std::string out;
+    assert(!queue.try_pop(out));
+    for (int i = 0; i < 4; ++i)
+    {
+        assert(queue.try_push(std::to_string(i)));
+    }
+    assert(!queue.try_push("full"));
+    assert(queue.try_pop(out));
+    assert(out == "0");
+    assert(queue.try_push("4"));
+    for (int i = 1; i <= 4; ++i)
+    {
+        assert(queue.try_pop(out));
+        assert(out == std::to_string(i));
+    }
+    assert(!queue.try_pop(out));
+
+    // test every pushed element is popped exactly once under contention
+    constexpr int threadsCount = 4;
+    constexpr std::uint64_t itemsPerThread = 20000;
+    mpmc_queue<std::uint64_t> sharedQueue(64);
+    std::atomic<std::uint64_t> poppedCount{ 0 };
+    std::atomic<std::uint64_t> poppedSum{ 0 };
+
+    my_vector<std::thread> threads;
+    for (int t = 0; t < threadsCount; ++t)
+    {
+        threads.emplace_back([&sharedQueue, t]()
+        {
+            for (std::uint64_t i = 0; i < itemsPerThread; ++i)
+            {
+                while (!sharedQueue.try_push(t * itemsPerThread + i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        threads.emplace_back([&]()
+        {
+            std::uint64_t value = 0;
+            while (poppedCount.load() < threadsCount * itemsPerThread)
+            {
+                if (sharedQueue.try_pop(value))
+                {
+                    poppedSum += value;
+                    ++poppedCount;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    const std::uint64_t total = threadsCount * itemsPerThread;
+    assert(poppedCount == total);
+    assert(poppedSum == total * (total - 1) / 2);
+}
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef TEST_MY_MDSPAN_H
+#define TEST_MY_MDSPAN_H
+
+#include <cassert>
+#include <numeric>
+
+#include "my_mdspan.h"
+
+void test_my_mdspan()
+{
+    // test row-major view over my_array<float, R * C>
+    my_array<float, 3 * 4> storage{};
+    std::iota(storage.begin(), storage.end(), 0.0f);
+    my_mdspan<float> matrix(my_span<float>(storage), 3, 4);
+    assert(matrix.rows() == 3);
+    assert(matrix.cols() == 4);
+    assert(matrix(1, 2) == 6.0f);
+
+    my_span<float> row = matrix.row(2);
+    assert(row.data() == storage.data() + 8);
+    assert(row.size() == 4);
+    assert(std::accumulate(row.begin(), row.end(), 0.0f) == 8.0f + 9.0f + 10.0f + 11.0f);
+
+    strided_view<float> col = matrix.col(1);
+    assert(col.size() == 3);
+    assert(col[0] == 1.0f && col[1] == 5.0f && col[2] == 9.0f);
+
+    my_mdspan<float> sub = matrix.submatrix(1, 1, 2, 2);
+    assert(sub(0, 0) == 5.0f);
+    assert(sub(1, 1) == 10.0f);
+    assert(sub.leading_dimension() == 4);
+    sub(1, 0) = -1.0f;
+    assert(storage[9] == -1.0f);
+
+    // test column-major view over the same buffer
+    my_mdspan<float, layout_left> colMajor(storage.data(), 4, 3);
+    assert(colMajor(0, 1) == 4.0f);
+    assert(colMajor(3, 2) == 11.0f);
+    my_span<float> contiguousCol = colMajor.col(2);
+    assert(contiguousCol.front() == 8.0f);
+    strided_view<float> stridedRow = colMajor.row(1);
+    assert(stridedRow.size() == 3);
+    assert(stridedRow[1] == 5.0f);
+    assert(stridedRow[2] == -1.0f);
+
+    const my_vector<int> values{ 1, 2, 3, 4 };
+    my_mdspan<const int> constMatrix(my_span<const int>(values), 2, 2);
+    assert(constMatrix(1, 0) == 3);
+}
+
+#endif
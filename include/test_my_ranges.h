@@ -0,0 +1,62 @@
+#ifndef TEST_MY_RANGES_H
+#define TEST_MY_RANGES_H
+
+#include <string>
+#include <cassert>
+#include <ranges>
+#include <algorithm>
+
+#include "my_ranges.h"
+#include "my_vector.h"
+#include "my_array.h"
+
+void test_my_ranges()
+{
+    // test the containers model the standard range concepts
+    static_assert(std::contiguous_iterator<my_vector<int>::iterator>);
+    static_assert(std::contiguous_iterator<my_vector<int>::const_iterator>);
+    static_assert(std::random_access_iterator<my_vector<int>::reverse_iterator>);
+    static_assert(std::same_as<std::iter_difference_t<my_vector<int>::iterator>, std::ptrdiff_t>);
+    static_assert(std::same_as<std::iter_value_t<my_vector<int>::const_iterator>, int>);
+    static_assert(std::ranges::contiguous_range<my_vector<std::string>>);
+    static_assert(std::ranges::contiguous_range<const my_vector<std::string>>);
+    static_assert(std::ranges::sized_range<my_vector<int>>);
+    static_assert(std::ranges::contiguous_range<my_array<int, 4>>);
+    static_assert(std::ranges::contiguous_range<const my_array<int, 4>>);
+    static_assert(std::ranges::sized_range<my_array<int, 4>>);
+
+    my_vector<int> vec{ 5, 3, 1, 4, 2 };
+    std::ranges::sort(vec);
+    assert((vec == my_vector<int>{ 1, 2, 3, 4, 5 }));
+    assert(std::ranges::data(vec) == vec.data());
+    assert(std::ranges::size(vec) == 5);
+    assert(*std::ranges::find(vec, 4) == 4);
+    assert(*(2 + vec.begin()) == 3);
+    assert(*(1 + vec.rbegin()) == 4);
+    assert(vec.rbegin() < vec.rbegin() + 1);
+
+    const my_array<int, 4> arr{ 4, 3, 2, 1 };
+    assert(std::ranges::max(arr) == 4);
+    assert(std::ranges::is_sorted(arr | std::views::reverse));
+
+    // test lazy pipelines collected with a single reservation
+    const my_vector<int> squares = vec | std::views::transform([](int i) { return i * i; }) | to<my_vector>();
+    assert((squares == my_vector<int>{ 1, 4, 9, 16, 25 }));
+    assert(squares.capacity() == squares.size());
+
+    const my_vector<std::string> strings = vec
+        | std::views::filter([](int i) { return i % 2 == 1; })
+        | std::views::transform([](int i) { return std::to_string(i); })
+        | std::views::take(2)
+        | to<my_vector>();
+    assert((strings == my_vector<std::string>{ "1", "3" }));
+
+    const my_vector<double, 64> aligned = arr | std::views::take(3) | to<my_vector<double, 64>>();
+    assert((aligned == my_vector<double>{ 4.0, 3.0, 2.0 }));
+    assert(aligned.capacity() == 3);
+
+    const my_vector<int> empty = std::views::empty<int> | to<my_vector>();
+    assert(empty.is_empty());
+}
+
+#endif
@@ -0,0 +1,140 @@
+#ifndef TEST_MY_SORT_H
+#define TEST_MY_SORT_H
+
+#include <string>
+#include <cassert>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+#include "my_sort.h"
+
+template <typename K>
+my_vector<K> random_keys(std::size_t n, std::mt19937& gen)
+{
+    my_vector<K> keys;
+    keys.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if constexpr (std::is_floating_point_v<K>)
+        {
+            keys.push_back(std::uniform_real_distribution<K>(-1e6, 1e6)(gen));
+        }
+        else
+        {
+            keys.push_back(static_cast<K>(gen()));
+        }
+    }
+
+    return keys;
+}
+
+template <typename K>
+void test_radix_sort_against_std_sort(std::mt19937& gen)
+{
+    for (std::size_t n : { 0, 1, 2, 100, 257, 5000, 70000 })
+    {
+        my_vector<K> keys = random_keys<K>(n, gen);
+        my_vector<K> expected = keys;
+        std::sort(expected.begin(), expected.end());
+
+        my_vector<K> lsd = keys;
+        radix_sort(lsd);
+        assert(lsd == expected);
+
+        my_vector<K> msd = keys;
+        radix_sort_in_place(msd);
+        assert(msd == expected);
+    }
+}
+
+void test_my_sort()
+{
+    std::mt19937 gen(11);
+
+    // test radix sorts against std::sort for every key width and signedness
+    test_radix_sort_against_std_sort<std::uint8_t>(gen);
+    test_radix_sort_against_std_sort<std::int16_t>(gen);
+    test_radix_sort_against_std_sort<std::uint32_t>(gen);
+    test_radix_sort_against_std_sort<std::int32_t>(gen);
+    test_radix_sort_against_std_sort<std::uint64_t>(gen);
+    test_radix_sort_against_std_sort<std::int64_t>(gen);
+    test_radix_sort_against_std_sort<float>(gen);
+    test_radix_sort_against_std_sort<double>(gen);
+
+    // test float special values
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    my_vector<float> special{ 1.5f, -0.0f, inf, -2.0f, 0.0f, -inf, 3.0f, -1e-30f };
+    for (int i = 0; i < 40; ++i)
+    {
+        special.push_back(static_cast<float>(i % 7) - 3.0f);
+    }
+    my_vector<float> specialInPlace = special;
+    radix_sort(special);
+    radix_sort_in_place(specialInPlace);
+    assert(std::is_sorted(special.begin(), special.end()));
+    assert(special == specialInPlace);
+    assert(special.front() == -inf && special.back() == inf);
+
+    // test key-value radix sort is stable
+    my_vector<std::uint32_t> keys;
+    my_vector<std::string> values;
+    for (std::uint32_t i = 0; i < 3000; ++i)
+    {
+        keys.push_back((i * 2654435761u) % 97);
+        values.push_back(std::to_string(i));
+    }
+    my_vector<std::uint32_t> keysCopy = keys;
+    my_sort(keys, values);
+    assert(std::is_sorted(keys.begin(), keys.end()));
+    for (std::size_t i = 1; i < keys.size(); ++i)
+    {
+        const std::uint32_t original = static_cast<std::uint32_t>(std::stoul(values[i]));
+        assert(keysCopy[original] == keys[i]);
+        if (keys[i] == keys[i - 1])
+        {
+            assert(std::stoul(values[i - 1]) < original);
+        }
+    }
+
+    my_vector<int> shortValues{ 1, 2 };
+    bool thrown = false;
+    try
+    {
+        radix_sort(keys, shortValues);
+    }
+    catch (const my_sort_size_mismatch&)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // test parallel merge sort for generic T and custom comparators
+    for (std::size_t threadsCount : { 1, 2, 3, 8 })
+    {
+        my_vector<std::string> strings;
+        for (int i = 0; i < 100000; ++i)
+        {
+            strings.push_back(std::to_string(gen() % 100000));
+        }
+        my_vector<std::string> expected = strings;
+        std::sort(expected.begin(), expected.end(), std::greater<>{});
+        parallel_merge_sort(strings, std::greater<>{}, threadsCount);
+        assert(strings == expected);
+    }
+
+    my_vector<std::string> small{ "b", "c", "a" };
+    my_sort(small);
+    assert((small == my_vector<std::string>{ "a", "b", "c" }));
+
+    my_vector<int> ints = random_keys<int>(1000, gen);
+    my_sort(ints, std::greater<>{});
+    assert(std::is_sorted(ints.begin(), ints.end(), std::greater<>{}));
+    my_sort(ints);
+    assert(std::is_sorted(ints.begin(), ints.end()));
+}
+
+#endif
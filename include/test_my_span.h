@@ -0,0 +1,71 @@
+#ifndef TEST_MY_SPAN_H
+#define TEST_MY_SPAN_H
+
+#include <string>
+#include <cassert>
+#include <numeric>
+
+#include "my_span.h"
+
+template <typename Span>
+void take_span(Span);
+
+// Whether { pointer, count } converts to Span implicitly, as in passing it to a function.
+template <typename Span>
+concept implicit_from_pointer_and_count = requires(typename Span::element_type* p, std::size_t n)
+{
+    take_span<Span>({ p, n });
+};
+
+void test_my_span()
+{
+    // test construction from containers and pointers
+    my_vector<int> vec{ 1, 2, 3, 4, 5 };
+    my_span vecSpan(vec);
+    static_assert(decltype(vecSpan)::extent == dynamic_extent);
+    assert(vecSpan.data() == vec.data());
+    assert(vecSpan.size() == 5);
+    assert(vecSpan.size_bytes() == 5 * sizeof(int));
+    vecSpan[0] = 10;
+    assert(vec[0] == 10);
+
+    const my_vector<int>& constVec = vec;
+    my_span constSpan(constVec);
+    static_assert(std::is_same_v<decltype(constSpan)::element_type, const int>);
+    assert(constSpan.back() == 5);
+
+    my_array<float, 6> arr{ 1, 2, 3, 4, 5, 6 };
+    my_span arrSpan(arr);
+    static_assert(decltype(arrSpan)::extent == 6);
+    static_assert(sizeof(arrSpan) == sizeof(float*));
+    assert(arrSpan.size() == 6);
+    my_span<const float> dynamicSpan = arrSpan;
+    assert(dynamicSpan.size() == 6);
+    assert(std::accumulate(dynamicSpan.begin(), dynamicSpan.end(), 0.0f) == 21.0f);
+
+    my_span<const std::string> empty;
+    assert(empty.is_empty());
+
+    // test zero-copy slicing
+    my_span<int> middle = vecSpan.subspan(1, 3);
+    assert(middle.data() == vec.data() + 1);
+    assert(middle.size() == 3);
+    assert(middle.front() == 2);
+    assert(middle.back() == 4);
+    assert(vecSpan.subspan(3).size() == 2);
+    assert(vecSpan.first(2).back() == 2);
+    assert(vecSpan.last(2).front() == 4);
+    my_span<int, 2> fixed = vecSpan.first<2>();
+    assert(fixed[1] == 2);
+
+    int raw[4]{ 7, 8, 9, 10 };
+    my_span<int> rawSpan(raw + 1, 2);
+    assert(rawSpan[0] == 8);
+    assert(rawSpan.end() - rawSpan.begin() == 2);
+    const my_span<int, 2> rawFixed(raw + 2, 2);
+    assert(rawFixed.back() == 10);
+    static_assert(implicit_from_pointer_and_count<my_span<int>>);
+    static_assert(!implicit_from_pointer_and_count<my_span<int, 2>>);
+}
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef TEST_MY_VECTOR_HARDENING_H
+#define TEST_MY_VECTOR_HARDENING_H
+
+#include <string>
+#include <cassert>
+#include <cstring>
+
+#include "my_vector_hardening.h"
+#include "my_vector.h"
+#include "my_span.h"
+#include "strided_view.h"
+
+struct hardening_violation
+{
+    const char* message;
+};
+
+inline void throw_hardening_violation(const char* message)
+{
+    throw hardening_violation{ message };
+}
+
+// Returns the message of the check f trips, or nullptr when it trips none.
+template <typename F>
+const char* hardening_violation_of(F f)
+{
+    try
+    {
+        f();
+    }
+    catch (const hardening_violation& violation)
+    {
+        return violation.message;
+    }
+    return nullptr;
+}
+
+void test_my_vector_hardening()
+{
+    // test iterators stay a bare pointer unless hardened
+#ifndef MY_VECTOR_HARDENED
+    static_assert(sizeof(my_vector<int>::iterator) == sizeof(int*));
+    static_assert(sizeof(my_vector<int>::const_reverse_iterator) == sizeof(int*));
+#else
+    const my_vector_violation_handler previous = set_my_vector_violation_handler(throw_hardening_violation);
+
+    // test bounds checks
+    my_vector<std::string> vec{ "a", "b", "c" };
+    assert(hardening_violation_of([&]() { return vec[2]; }) == nullptr);
+    assert(std::strstr(hardening_violation_of([&]() { return vec[3]; }), "operator[]") != nullptr);
+    assert(hardening_violation_of([&]() { return std::as_const(vec)[7]; }) != nullptr);
+
+    my_vector<std::string> empty;
+    assert(hardening_violation_of([&]() { return empty.front(); }) != nullptr);
+    assert(hardening_violation_of([&]() { return empty.back(); }) != nullptr);
+    assert(hardening_violation_of([&]() { empty.pop_back(); }) != nullptr);
+    assert(hardening_violation_of([&]() { vec.erase(vec.cend()); }) != nullptr);
+    assert(hardening_violation_of([&]() { vec.erase(vec.begin() + 2, vec.begin() + 1); }) != nullptr);
+    assert(hardening_violation_of([&]() { vec.insert(vec.cend() + 1, std::string("x")); }) != nullptr);
+    assert(vec.size() == 3);
+
+    // test iterator dereferences outside the elements
+    assert(hardening_violation_of([&]() { return *vec.end(); }) != nullptr);
+    assert(hardening_violation_of([&]() { return vec.begin()[3]; }) != nullptr);
+    assert(hardening_violation_of([&]() { return *vec.rend(); }) != nullptr);
+    assert(hardening_violation_of([&]() { return *vec.crbegin(); }) == nullptr);
+    assert(std::to_address(vec.end()) == vec.data() + 3);
+
+    // test reallocation invalidates iterators, but appending within capacity does not
+    vec.reserve(8);
+    auto it = vec.begin();
+    vec.push_back("d");
+    assert(hardening_violation_of([&]() { return *it; }) == nullptr);
+    vec.reserve(64);
+    assert(std::strstr(hardening_violation_of([&]() { return *it; }), "reallocated") != nullptr);
+    my_vector<std::string>::const_iterator constIt = vec.begin();
+    vec = { "x" };
+    assert(hardening_violation_of([&]() { return *constIt; }) != nullptr);
+
+    // test erasing the tail is caught even without a reallocation
+    vec = { "a", "b", "c", "d", "e", "f", "g", "h" };
+    auto last = vec.end() - 1;
+    vec.pop_back();
+    assert(hardening_violation_of([&]() { return *last; }) != nullptr);
+
+    // test swap and move hand valid iterators on with the buffer
+    my_vector<std::string> first{ "1", "2" };
+    my_vector<std::string> second{ "3" };
+    auto firstIt = first.begin();
+    first.swap(second);
+    assert(hardening_violation_of([&]() { return *firstIt; }) == nullptr);
+    assert(*firstIt == "1" && firstIt == second.begin());
+    my_vector<std::string> moved(std::move(second));
+    assert(hardening_violation_of([&]() { return *firstIt; }) == nullptr);
+    assert(firstIt + 1 == moved.end() - 1);
+    my_vector<std::string> assigned;
+    assigned = std::move(moved);
+    assert(hardening_violation_of([&]() { return firstIt[1]; }) == nullptr);
+    assert(firstIt[1] == "2");
+    assert(hardening_violation_of([&]() { return *moved.begin(); }) != nullptr);
+
+    // test iterators into a destroyed vector are caught
+    my_vector<std::string>::iterator orphan;
+    {
+        my_vector<std::string> scoped{ "x" };
+        orphan = scoped.begin();
+    }
+    assert(std::strstr(hardening_violation_of([&]() { return *orphan; }), "released") != nullptr);
+
+    // test a span's count has to match its static extent
+    int raw[4]{ 1, 2, 3, 4 };
+    assert(hardening_violation_of([&]() { return my_span<int, 4>(raw, 4).back(); }) == nullptr);
+    assert(std::strstr(hardening_violation_of([&]() { return my_span<int, 4>(raw, 2).back(); }), "static extent") != nullptr);
+
+    // test a strided view refuses a stride of 0
+    assert(hardening_violation_of([&]() { return strided_view<int>(my_span<int>(raw, 4), 2).size(); }) == nullptr);
+    assert(hardening_violation_of([&]() { return strided_view<int>(my_span<int>(raw, 4), 0).size(); }) != nullptr);
+
+    set_my_vector_violation_handler(previous);
+#endif
+}
+
+#endif
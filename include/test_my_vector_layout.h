@@ -0,0 +1,178 @@
+#ifndef TEST_MY_VECTOR_LAYOUT_H
+#define TEST_MY_VECTOR_LAYOUT_H
+
+#include <string>
+#include <cassert>
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "my_vector.h"
+#include "my_span.h"
+#include "my_sort.h"
+#include "set_ops.h"
+
+// Random pushes, inserts, erases and resizes, checked against std::vector after every step.
+template <typename Vector>
+void check_layout_against_std_vector()
+{
+    Vector vec;
+    std::vector<std::string> reference;
+    std::mt19937 gen(77);
+    std::uniform_int_distribution<int> opDist(0, 7);
+    for (int i = 0; i < 4000; ++i)
+    {
+        const int op = opDist(gen);
+        const std::string value = std::to_string(i);
+        if (op <= 2)
+        {
+            vec.push_back(value);
+            reference.push_back(value);
+        }
+        else if (op == 3)
+        {
+            const std::ptrdiff_t pos = std::uniform_int_distribution<std::ptrdiff_t>(0, std::ssize(reference))(gen);
+            vec.insert(vec.cbegin() + pos, std::string(value));
+            reference.insert(reference.begin() + pos, value);
+        }
+        else if (op == 4 && !reference.empty())
+        {
+            const std::ptrdiff_t pos = std::uniform_int_distribution<std::ptrdiff_t>(0, std::ssize(reference) - 1)(gen);
+            vec.erase(vec.cbegin() + pos);
+            reference.erase(reference.begin() + pos);
+        }
+        else if (op == 5 && !reference.empty())
+        {
+            vec.pop_back();
+            reference.pop_back();
+        }
+        else if (op == 6)
+        {
+            const std::size_t count = std::uniform_int_distribution<std::size_t>(0, 63)(gen);
+            vec.resize(count, value);
+            reference.resize(count, value);
+        }
+        else if (i % 500 == 7)
+        {
+            vec.clear();
+            reference.clear();
+        }
+
+        assert(vec.size() == reference.size());
+        assert(vec.capacity() >= vec.size());
+        assert(std::equal(vec.begin(), vec.end(), reference.begin(), reference.end()));
+    }
+}
+
+void test_my_vector_layout()
+{
+    // test the sizes the layouts are for, which hardening and profiling add members to
+#if !defined(MY_VECTOR_HARDENED) && !defined(MY_VECTOR_PROFILE)
+    static_assert(sizeof(my_vector<int>) == 3 * sizeof(void*));
+    static_assert(sizeof(compact_vector<int>) == sizeof(void*) + 2 * sizeof(std::uint32_t));
+    static_assert(sizeof(thin_vector<int>) == sizeof(void*));
+#endif
+
+    // test every layout behaves like std::vector
+    check_layout_against_std_vector<my_vector<std::string>>();
+    check_layout_against_std_vector<compact_vector<std::string>>();
+    check_layout_against_std_vector<thin_vector<std::string>>();
+
+    // test an empty thin vector owns nothing
+    thin_vector<std::unique_ptr<int>> thin;
+    assert(thin.data() == nullptr);
+    assert(thin.size() == 0 && thin.capacity() == 0 && thin.is_empty());
+    thin.push_back(std::make_unique<int>(1));
+    thin.emplace_back(std::make_unique<int>(2));
+    assert(thin.size() == 2 && *thin.back() == 2);
+    thin.reserve(100);
+    assert(thin.capacity() == 100 && *thin.front() == 1);
+    thin.clear();
+    assert(thin.data() == nullptr);
+
+    // test moves, swaps and copies keep size and capacity with the buffer
+    thin_vector<std::string> words{ "a", "b", "c" };
+    thin_vector<std::string> moved = std::move(words);
+    assert(words.data() == nullptr && words.is_empty());
+    assert(moved.size() == 3);
+    words = { "x" };
+    words.swap(moved);
+    assert(words.size() == 3 && moved.size() == 1);
+    const thin_vector<std::string> copy = words;
+    assert(copy == words);
+    assert((copy == my_vector<std::string>{ "a", "b", "c" }));
+    assert((copy < compact_vector<std::string>{ "b" }));
+
+    // test over-aligned elements stay aligned behind the header
+    thin_vector<double, 64> aligned(5, 1.5);
+    assert(reinterpret_cast<std::uintptr_t>(aligned.data()) % 64 == 0);
+    assert(aligned.aligned_data()[4] == 1.5);
+    aligned.shrink_to_fit();
+    assert(aligned.capacity() == 5);
+
+    // test compact and thin vectors refuse capacities past 32 bits
+    compact_vector<char> bytes(3, 'x');
+    const std::size_t bytesCapacity = bytes.capacity();
+    bool thrown = false;
+    try
+    {
+        bytes.reserve(std::size_t{ 1 } << 32);
+    }
+    catch (const my_vector_length_error&)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(bytes.size() == 3 && bytes.capacity() == bytesCapacity);
+    thin_vector<char> thinBytes;
+    thrown = false;
+    try
+    {
+        thinBytes.resize(std::size_t{ 1 } << 33);
+    }
+    catch (const my_vector_length_error&)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(thinBytes.data() == nullptr);
+
+    // test spans over other layouts
+    compact_vector<int> ints{ 1, 2, 3 };
+    my_span span = ints;
+    span[1] = 20;
+    assert(ints[1] == 20);
+    const thin_vector<int> constInts{ 4, 5 };
+    my_span constSpan = constInts;
+    assert(constSpan.size() == 2 && constSpan[0] == 4);
+
+    // test sorting and set operations on other layouts
+    compact_vector<unsigned> keys;
+    thin_vector<std::string> names;
+    for (unsigned i = 0; i < 1000; ++i)
+    {
+        keys.push_back(i * 7919 % 1000);
+        names.push_back(std::to_string(i * 7919 % 1000));
+    }
+    thin_vector<unsigned> values(keys.begin(), keys.end());
+    my_sort(keys);
+    assert(std::is_sorted(keys.begin(), keys.end()) && keys.size() == 1000);
+    my_sort(names, std::greater<>{});
+    assert(std::is_sorted(names.begin(), names.end(), std::greater<>{}));
+    compact_vector<unsigned> sortedKeys(values.begin(), values.end());
+    my_sort(sortedKeys, values);
+    assert(sortedKeys == keys && values == thin_vector<unsigned>(keys.begin(), keys.end()));
+    radix_sort_in_place(values);
+
+    const thin_vector<int> duplicates{ 3, 1, 3, 2, 1 };
+    assert((dedupe(duplicates) == thin_vector<int>{ 3, 1, 2 }));
+    assert((intersect(duplicates, compact_vector<int>{ 2, 3, 9 }) == thin_vector<int>{ 3, 2 }));
+    assert((difference(compact_vector<int>{ 1, 4 }, duplicates) == compact_vector<int>{ 4 }));
+    assert(count_distinct(duplicates) == 3);
+    assert(count_distinct_approx(duplicates) > 2.5 && count_distinct_approx(duplicates) < 3.5);
+}
+
+#endif
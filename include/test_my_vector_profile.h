@@ -0,0 +1,99 @@
+#ifndef TEST_MY_VECTOR_PROFILE_H
+#define TEST_MY_VECTOR_PROFILE_H
+
+#include <string>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <source_location>
+#include <type_traits>
+
+#include "my_vector_profile.h"
+#include "my_vector.h"
+
+inline vector_profile_totals profile_totals_at_line(unsigned line)
+{
+    vector_profile_totals result;
+    for_each_vector_profile_site([&](const std::source_location& location, const vector_profile_totals& totals)
+    {
+        if (location.line() == line && std::strstr(location.file_name(), "test_my_vector_profile.h") != nullptr)
+        {
+            result = totals;
+        }
+    });
+
+    return result;
+}
+
+void test_my_vector_profile()
+{
+    // test the registry groups hooks by site and sums their usage
+    struct Owner
+    {
+        std::size_t size;
+        std::size_t capacity;
+    };
+    const auto usage = [](const void* owner)
+    {
+        const auto* self = static_cast<const Owner*>(owner);
+        return vector_profile_usage{ self->size, self->capacity };
+    };
+
+    const Owner first{ 10, 16 };
+    const Owner second{ 30, 64 };
+    const std::source_location site = std::source_location::current();
+    {
+        vector_profile_hook firstHook;
+        vector_profile_hook secondHook;
+        firstHook.attach(&first, usage, site);
+        secondHook.attach(&second, usage, site);
+        secondHook.count_reallocation();
+
+        const vector_profile_totals totals = vector_profile_totals_at(site);
+        assert(totals.liveCount == 2);
+        assert(totals.sizeBytes == 40 && totals.capacityBytes == 80);
+        assert(totals.waste_bytes() == 40 && totals.waste_ratio() == 0.5);
+        assert(totals.reallocations == 1);
+    }
+    const vector_profile_totals afterScope = vector_profile_totals_at(site);
+    assert(afterScope.liveCount == 0 && afterScope.constructedCount == 2);
+    assert(afterScope.capacityBytes == 0);
+
+    // test the report lists the site
+    std::FILE* out = std::tmpfile();
+    write_vector_profile(out);
+    std::rewind(out);
+    std::string report(1 << 16, '\0');
+    report.resize(std::fread(report.data(), 1, report.size(), out));
+    std::fclose(out);
+    assert(report.find("waste B") != std::string::npos);
+    assert(report.find("test_my_vector_profile.h:" + std::to_string(site.line())) != std::string::npos);
+
+#ifdef MY_VECTOR_PROFILE
+    // test my_vector reports its construction site, reallocations included
+    const unsigned line = std::source_location::current().line() + 1;
+    my_vector<int> profiled;
+    for (int i = 0; i < 5; ++i)
+    {
+        profiled.push_back(i);
+    }
+    const vector_profile_totals totals = profile_totals_at_line(line);
+    assert(totals.liveCount == 1);
+    assert(totals.sizeBytes == 5 * sizeof(int) && totals.capacityBytes == 8 * sizeof(int));
+    assert(totals.reallocations == 4);
+
+    // test assignment keeps the vector at its own site
+    profiled = my_vector<int>{ 1, 2 };
+    assert(profile_totals_at_line(line).liveCount == 1);
+    assert(profile_totals_at_line(line).sizeBytes == 2 * sizeof(int));
+
+    // test the location parameter does not make a my_vector out of a source_location
+    static_assert(!std::is_convertible_v<std::source_location, my_vector<int>>);
+    const unsigned braceLine = std::source_location::current().line() + 1;
+    my_vector<int> braced = {};
+    braced.push_back(1);
+    assert(profile_totals_at_line(braceLine).liveCount == 1);
+#endif
+}
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef TEST_MY_VECTOR_TRACE_H
+#define TEST_MY_VECTOR_TRACE_H
+
+#include <string>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+#include "my_vector_trace.h"
+#include "my_vector.h"
+
+void test_my_vector_trace()
+{
+    // test scopes land in the ring in order
+    trace_clear();
+    {
+        trace_scope outer("outer", 3, 24);
+        trace_scope inner("inner", 1, 8);
+    }
+    assert(trace_event_count() == 2);
+    assert(std::strcmp(trace_event_at(0).name, "inner") == 0);
+    assert(std::strcmp(trace_event_at(1).name, "outer") == 0);
+    assert(trace_event_at(1).elements == 3 && trace_event_at(1).bytes == 24);
+    assert(trace_event_at(1).startNs <= trace_event_at(0).startNs);
+    assert(trace_event_at(0).thread == trace_event_at(1).thread);
+
+    // test the ring overwrites the oldest events
+    trace_clear();
+    for (std::size_t i = 0; i < MY_VECTOR_TRACE_CAPACITY + 5; ++i)
+    {
+        trace_record("event", i, 0, i, 0);
+    }
+    assert(trace_event_count() == MY_VECTOR_TRACE_CAPACITY);
+    assert(trace_overwritten_count() == 5);
+    assert(trace_event_at(0).elements == 5);
+
+    // test Chrome trace output
+    trace_clear();
+    trace_record("reallocate", 1500, 2500, 10, 80);
+    std::FILE* out = std::tmpfile();
+    assert(write_chrome_trace(out));
+    std::rewind(out);
+    std::string json(4096, '\0');
+    json.resize(std::fread(json.data(), 1, json.size(), out));
+    std::fclose(out);
+    assert(json.find("\"traceEvents\":[") != std::string::npos);
+    assert(json.find("\"name\":\"reallocate\"") != std::string::npos);
+    assert(json.find("\"ts\":1.500,\"dur\":2.500") != std::string::npos);
+    assert(json.find("\"args\":{\"elements\":10,\"bytes\":80}") != std::string::npos);
+
+    // test my_vector fires its hooks only when tracing is compiled in
+    trace_clear();
+    my_vector<int> vec{ 1, 2, 3, 4 };
+    const my_vector<int> extra{ 5, 6, 7, 8, 9 };
+    vec.insert(vec.cbegin() + 1, extra.begin(), extra.end());
+    vec.erase(vec.begin(), vec.begin() + 2);
+    vec.shrink_to_fit();
+#ifdef MY_VECTOR_TRACE
+    bool sawInsert = false;
+    bool sawShrink = false;
+    for (std::size_t i = 0; i < trace_event_count(); ++i)
+    {
+        const trace_event& event = trace_event_at(i);
+        if (std::strcmp(event.name, "insert") == 0 && event.elements == 5)
+        {
+            sawInsert = event.bytes == 3 * sizeof(int);
+        }
+        sawShrink |= std::strcmp(event.name, "shrink_to_fit") == 0;
+    }
+    assert(sawInsert && sawShrink);
+#else
+    assert(trace_event_count() == 0);
+#endif
+}
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef TEST_OPEN_HASH_SET_H
+#define TEST_OPEN_HASH_SET_H
+
+#include <string>
+#include <cassert>
+#include <random>
+#include <unordered_set>
+
+#include "open_hash_set.h"
+
+void test_open_hash_set()
+{
+    // test insert and contains
+    open_hash_set<int> set;
+    assert(set.is_empty());
+    assert(!set.contains(3));
+    assert(set.insert(3));
+    assert(!set.insert(3));
+    assert(set.contains(3));
+    assert(!set.contains(4));
+    assert(set.size() == 1);
+
+    // test growth keeps every element against std::unordered_set
+    std::mt19937 gen(5);
+    std::uniform_int_distribution<int> dist(-5000, 5000);
+    std::unordered_set<int> reference{ 3 };
+    for (int i = 0; i < 20000; ++i)
+    {
+        const int value = dist(gen);
+        const bool inserted = set.insert(value);
+        assert(inserted == reference.insert(value).second);
+    }
+    assert(set.size() == reference.size());
+    assert(set.slots_count() >= 2 * set.size());
+    for (int value = -5001; value <= 5001; ++value)
+    {
+        assert(set.contains(value) == (reference.count(value) == 1));
+    }
+
+    // test reserve and clear
+    open_hash_set<std::string> strings(100);
+    const std::size_t slots = strings.slots_count();
+    for (int i = 0; i < 100; ++i)
+    {
+        strings.insert(std::to_string(i));
+    }
+    assert(strings.slots_count() == slots);
+    assert(strings.contains("42"));
+    strings.clear();
+    assert(strings.is_empty());
+    assert(!strings.contains("42"));
+
+    // test floats: -0.0 and 0.0 are one element
+    open_hash_set<double> doubles;
+    assert(doubles.insert(0.0));
+    assert(!doubles.insert(-0.0));
+    assert(doubles.contains(-0.0));
+
+    // test types wider than 64 bits
+    open_hash_set<long double> longDoubles;
+    for (int i = 0; i < 100; ++i)
+    {
+        assert(longDoubles.insert(i * 0.5L));
+    }
+    assert(!longDoubles.insert(-0.0L) && longDoubles.contains(49.5L) && !longDoubles.contains(50.0L));
+#ifdef __SIZEOF_INT128__
+    open_hash_set<unsigned __int128> wide;
+    assert(wide.insert(static_cast<unsigned __int128>(1) << 100));
+    assert(wide.insert(1));
+    assert(!wide.insert(static_cast<unsigned __int128>(1) << 100));
+    assert(set_hash<unsigned __int128>{}(1) != set_hash<unsigned __int128>{}(static_cast<unsigned __int128>(1) << 64));
+#endif
+}
+
+#endif
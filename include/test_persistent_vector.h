@@ -0,0 +1,98 @@
+#ifndef TEST_PERSISTENT_VECTOR_H
+#define TEST_PERSISTENT_VECTOR_H
+
+#include <string>
+#include <cassert>
+#include <random>
+#include <algorithm>
+
+#include "persistent_vector.h"
+
+void test_persistent_vector()
+{
+    // test construction and access
+    const persistent_vector<std::string> small{ "a", "b", "c" };
+    assert(small.size() == 3);
+    assert(small[1] == "b");
+    assert(small.front() == "a");
+    assert(small.back() == "c");
+    assert(persistent_vector<int>{}.is_empty());
+
+    bool caughtError = false;
+    try
+    {
+        small.at(3);
+    }
+    catch (const persistent_vector_out_of_range&)
+    {
+        caughtError = true;
+    }
+    assert(caughtError);
+
+    // test old versions are unaffected by push_back/set
+    const persistent_vector<std::string> bigger = small.push_back("d");
+    const persistent_vector<std::string> changed = bigger.set(0, "z");
+    assert(small.size() == 3);
+    assert(bigger.size() == 4);
+    assert(bigger[0] == "a");
+    assert(bigger[3] == "d");
+    assert(changed[0] == "z");
+    assert(changed[3] == "d");
+
+    // test growth over several trie levels against my_vector, keeping snapshots
+    constexpr int count = 40000;
+    persistent_vector<int> vec;
+    my_vector<persistent_vector<int>> snapshots;
+    for (int i = 0; i < count; ++i)
+    {
+        if (i % 4096 == 0)
+        {
+            snapshots.push_back(vec);
+        }
+        vec = vec.push_back(i);
+    }
+    assert(vec.size() == count);
+    for (int i = 0; i < count; ++i)
+    {
+        assert(vec[i] == i);
+    }
+    for (std::size_t s = 0; s < snapshots.size(); ++s)
+    {
+        assert(snapshots[s].size() == s * 4096);
+        assert(snapshots[s].is_empty() || snapshots[s].back() == static_cast<int>(s * 4096 - 1));
+    }
+
+    std::mt19937 gen(3);
+    std::uniform_int_distribution<int> dist(0, count - 1);
+    my_vector<int> reference = vec.to_my_vector();
+    persistent_vector<int> edited = vec;
+    for (int i = 0; i < 1000; ++i)
+    {
+        const int index = dist(gen);
+        edited = edited.set(index, -i);
+        reference[index] = -i;
+    }
+    assert(edited.to_my_vector() == reference);
+    assert(vec[count - 1] == count - 1);
+
+    // test transient batch edits and conversions
+    persistent_vector<int>::transient builder = vec.to_transient();
+    for (int i = 0; i < 100; ++i)
+    {
+        builder.push_back(count + i);
+        builder.set(i * 7, 0);
+    }
+    const persistent_vector<int> batched = builder.persistent();
+    assert(builder.size() == 0);
+    assert(batched.size() == count + 100);
+    assert(batched[7] == 0);
+    assert(batched[count + 99] == count + 99);
+    assert(vec[7] == 7);
+    assert(vec.size() == count);
+
+    const persistent_vector<int> fromVector(reference);
+    assert(fromVector.to_my_vector() == reference);
+    assert(std::equal(fromVector.begin(), fromVector.end(), reference.begin(), reference.end()));
+}
+
+#endif
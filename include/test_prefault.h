@@ -0,0 +1,83 @@
+#ifndef TEST_PREFAULT_H
+#define TEST_PREFAULT_H
+
+#include <cassert>
+#include <cstddef>
+#include <utility>
+
+#include <sys/resource.h>
+
+#include "my_vector.h"
+#include "prefault.h"
+
+inline long minor_page_faults()
+{
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_minflt;
+}
+
+// Page faults taken while writing every element between size() and capacity().
+inline long faults_filling(my_vector<char>& vec)
+{
+    const long before = minor_page_faults();
+    vec.resize(vec.capacity(), 'x');
+    return minor_page_faults() - before;
+}
+
+void test_prefault()
+{
+    // Big enough that malloc maps fresh pages for it.
+    constexpr std::size_t bytes = std::size_t{ 32 } << 20;
+    [[maybe_unused]] const long pages = static_cast<long>(bytes / prefault_detail::page_size());
+
+    // test every policy keeps the elements and leaves almost no faults for the first fill
+    for (const prefault_policy policy : { prefault_policy::populate, prefault_policy::parallel_touch, prefault_policy::background })
+    {
+        my_vector<char> vec(1000, 'a');
+        prefault_handle handle = reserve(vec, bytes, policy);
+        handle.wait();
+        assert(handle.is_ready());
+        assert(vec.size() == 1000 && vec.capacity() == bytes);
+        assert(vec[0] == 'a' && vec[999] == 'a');
+        [[maybe_unused]] const long faults = faults_filling(vec);
+#if !defined(__SANITIZE_ADDRESS__) && !defined(__SANITIZE_THREAD__)
+        // Sanitizers fault in their own shadow memory as the elements are written.
+        assert(faults < pages / 8);
+#endif
+        assert(vec[999] == 'a' && vec[1000] == 'x' && vec[bytes - 1] == 'x');
+    }
+
+    // test filling while the background prefault runs loses no writes
+    {
+        my_vector<char> vec;
+        prefault_handle handle = reserve(vec, bytes, prefault_policy::background);
+        vec.resize(bytes, 'y');
+        handle.wait();
+        for (std::size_t i = 0; i < bytes; i += 4093)
+        {
+            assert(vec[i] == 'y');
+        }
+    }
+
+    // test dropping a background handle early stops it before the buffer goes
+    {
+        my_vector<char> vec;
+        {
+            prefault_handle handle = reserve(vec, bytes, prefault_policy::background);
+        }
+        vec.push_back('z');
+        assert(vec.back() == 'z');
+    }
+
+    // test small and empty ranges
+    my_vector<int> small;
+    reserve(small, 0, prefault_policy::parallel_touch).wait();
+    reserve(small, 10, prefault_policy::populate).wait();
+    small.push_back(1);
+    assert(small.capacity() == 10 && small[0] == 1);
+    prefault_handle ready;
+    assert(ready.is_ready());
+}
+
+#endif
@@ -0,0 +1,178 @@
+#ifndef TEST_RING_VECTOR_H
+#define TEST_RING_VECTOR_H
+
+#include <string>
+#include <cassert>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <utility>
+
+#include "ring_vector.h"
+
+void test_ring_vector()
+{
+    // test FIFO use keeps the capacity once the window is full
+    ring_vector<int> window;
+    for (int i = 0; i < 1000; ++i)
+    {
+        window.push_back(i);
+    }
+    const std::size_t windowCapacity = window.capacity();
+    for (int i = 1000; i < 100000; ++i)
+    {
+        window.push_back(i);
+        window.pop_front();
+    }
+    assert(window.capacity() == windowCapacity);
+    assert(window.size() == 1000);
+    assert(window.front() == 99000);
+    assert(window.back() == 99999);
+    assert(window[10] == 99010);
+
+    // test the two spans cover the elements in order
+    auto [first, second] = window.as_spans();
+    assert(first.size() + second.size() == window.size());
+    assert(first.front() == 99000);
+    if (!second.is_empty())
+    {
+        assert(second.front() == first.back() + 1);
+        assert(second.back() == 99999);
+    }
+    long long sum = 0;
+    for (const auto& span : { first, second })
+    {
+        sum = std::accumulate(span.begin(), span.end(), sum);
+    }
+    assert(sum == (99000LL + 99999LL) * 1000 / 2);
+
+    // test wrapped iteration
+    static_assert(std::random_access_iterator<ring_vector<int>::iterator>);
+    static_assert(std::random_access_iterator<ring_vector<int>::const_iterator>);
+    assert(std::distance(window.begin(), window.end()) == 1000);
+    int expected = 99000;
+    for (const int value : window)
+    {
+        assert(value == expected++);
+    }
+    assert(*(window.end() - 1) == 99999);
+    assert(window.cbegin()[999] == 99999);
+    assert(window.begin() < window.end());
+
+    window.pop_front_n(990);
+    assert(window.size() == 10);
+    assert(window.front() == 99990);
+
+    // test both ends and growth while wrapped
+    ring_vector<std::string> words{ "c", "d" };
+    words.push_front("b");
+    words.push_front("a");
+    words.push_back("e");
+    assert((words == ring_vector<std::string>{ "a", "b", "c", "d", "e" }));
+    words.pop_back();
+    words.pop_front();
+    assert((words == ring_vector<std::string>{ "b", "c", "d" }));
+    assert(words.at(2) == "d");
+    bool thrown = false;
+    try
+    {
+        words.at(3);
+    }
+    catch (const my_vector_out_of_range&)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // test arguments that alias an element survive growth
+    ring_vector<std::string> aliasing{ "x", "y" };
+    assert(aliasing.size() == aliasing.capacity());
+    aliasing.push_back(aliasing.front());
+    aliasing.push_front(aliasing.back());
+    assert((aliasing == ring_vector<std::string>{ "x", "x", "y", "x" }));
+
+    // test overwrite_oldest drops from the other end once full
+    ring_vector<int> latest(overwrite_oldest, 5);
+    assert(latest.max_size() == 5);
+    for (int i = 0; i < 12; ++i)
+    {
+        latest.push_back(i);
+    }
+    assert(latest.is_full());
+    assert(latest.capacity() == 8);
+    assert((latest == ring_vector<int>{ 7, 8, 9, 10, 11 }));
+    latest.push_front(6);
+    assert((latest == ring_vector<int>{ 6, 7, 8, 9, 10 }));
+
+    ring_vector<std::string> names(overwrite_oldest, 2);
+    names.push_back("a");
+    names.push_back("b");
+    names.push_back(names.front());
+    assert((names == ring_vector<std::string>{ "b", "a" }));
+
+    // test copies keep the mode and moves leave an empty ring
+    ring_vector<int> copy = latest;
+    copy.push_back(11);
+    assert((copy == ring_vector<int>{ 7, 8, 9, 10, 11 }));
+    assert(latest.front() == 6);
+    ring_vector<int> moved = std::move(copy);
+    assert(copy.is_empty());
+    assert(moved.max_size() == 5);
+    moved = window;
+    assert(moved == window);
+    assert(moved.max_size() == 0);
+    moved.clear();
+    assert(moved.is_empty());
+
+    // test an overwrite_oldest ring against a std::deque trimmed to the same bound, under a mix of
+    // emplaces at both ends, single pops and pop_front_n, reading it back through as_spans
+    std::mt19937 gen(777);
+    std::uniform_int_distribution<int> opDist(0, 9);
+    ring_vector<std::unique_ptr<int>> recent(overwrite_oldest, 100);
+    std::deque<int> reference;
+    for (int i = 0; i < 20000; ++i)
+    {
+        const int op = opDist(gen);
+        if (op < 5)
+        {
+            recent.emplace_back(std::make_unique<int>(i));
+            reference.push_back(i);
+            if (reference.size() > recent.max_size())
+            {
+                reference.pop_front();
+            }
+        }
+        else if (op < 7)
+        {
+            recent.emplace_front(std::make_unique<int>(i));
+            reference.push_front(i);
+            if (reference.size() > recent.max_size())
+            {
+                reference.pop_back();
+            }
+        }
+        else if (op < 9)
+        {
+            const std::size_t count = std::uniform_int_distribution<std::size_t>(0, reference.size())(gen);
+            recent.pop_front_n(count);
+            reference.erase(reference.begin(), reference.begin() + static_cast<std::ptrdiff_t>(count));
+        }
+        else if (!reference.empty())
+        {
+            recent.pop_back();
+            reference.pop_back();
+        }
+        assert(recent.size() == reference.size());
+        assert(recent.is_full() == (reference.size() == recent.max_size()));
+    }
+    const auto [head, tail] = recent.as_spans();
+    assert(head.size() + tail.size() == reference.size());
+    for (std::size_t i = 0; i < reference.size(); ++i)
+    {
+        assert(*(i < head.size() ? head[i] : tail[i - head.size()]) == reference[i]);
+    }
+}
+
+#endif
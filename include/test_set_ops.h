@@ -0,0 +1,61 @@
+#ifndef TEST_SET_OPS_H
+#define TEST_SET_OPS_H
+
+#include <string>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+
+#include "set_ops.h"
+
+void test_set_ops()
+{
+    // test dedupe keeps first occurrences in order
+    const my_vector<int> a{ 5, 1, 5, 3, 1, 7, 3, 9 };
+    const my_vector<int> b{ 9, 3, 3, 4, 5 };
+    assert((dedupe(a) == my_vector<int>{ 5, 1, 3, 7, 9 }));
+    assert(dedupe(my_vector<int>{}).is_empty());
+
+    // test intersect and difference
+    assert((intersect(a, b) == my_vector<int>{ 5, 3, 9 }));
+    assert((difference(a, b) == my_vector<int>{ 1, 7 }));
+    assert((difference(b, a) == my_vector<int>{ 4 }));
+    assert(intersect(a, my_vector<int>{}).is_empty());
+    assert((difference(a, my_vector<int>{}) == dedupe(a)));
+
+    const my_vector<std::string> words{ "b", "a", "b", "c" };
+    assert((dedupe(words) == my_vector<std::string>{ "b", "a", "c" }));
+    assert((intersect(words, my_vector<std::string>{ "c", "b" }) == my_vector<std::string>{ "b", "c" }));
+
+    // test count_distinct exact and approximate
+    assert(count_distinct(a) == 5);
+    my_vector<std::uint64_t> large;
+    for (std::uint64_t i = 0; i < 200000; ++i)
+    {
+        large.push_back(i % 50000);
+    }
+    assert(count_distinct(large) == 50000);
+    assert(dedupe(large).size() == 50000);
+    const double estimate = count_distinct_approx(large);
+    assert(std::abs(estimate - 50000.0) < 50000.0 * 0.05);
+    assert(std::abs(count_distinct_approx(a) - 5.0) < 0.5);
+
+    // test hyperloglog merge matches a counter fed with both inputs
+    hyperloglog lhs;
+    hyperloglog rhs;
+    hyperloglog both;
+    for (int i = 0; i < 30000; ++i)
+    {
+        lhs.add(i);
+        rhs.add(i + 20000);
+        both.add(i);
+        both.add(i + 20000);
+    }
+    lhs.merge(rhs);
+    assert(lhs.estimate() == both.estimate());
+    assert(std::abs(both.estimate() - 50000.0) < 50000.0 * 0.05);
+    both.clear();
+    assert(both.estimate() == 0.0);
+}
+
+#endif
@@ -0,0 +1,95 @@
+#ifndef TEST_SPSC_RING_H
+#define TEST_SPSC_RING_H
+
+#include <string>
+#include <cassert>
+#include <thread>
+#include <cstdint>
+
+#include "spsc_ring.h"
+
+void test_spsc_ring()
+{
+    // test single element push/pop
+    spsc_ring<std::string, 4> ring;
+    static_assert(spsc_ring<int, 8>::capacity() == 8);
+    assert(ring.is_empty());
+    assert(ring.try_push("a"));
+    assert(ring.try_push(std::string("b")));
+    assert(ring.size() == 2);
+
+    std::string out;
+    assert(ring.try_pop(out));
+    assert(out == "a");
+    assert(ring.try_pop(out));
+    assert(out == "b");
+    assert(!ring.try_pop(out));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        assert(ring.try_push(std::to_string(i)));
+    }
+    assert(!ring.try_push("full"));
+    assert(ring.size() == 4);
+
+    // test batches wrapping around the end of the buffer
+    spsc_ring<int, 8> intRing;
+    int values[8]{ 0, 1, 2, 3, 4, 5, 6, 7 };
+    int popped[8]{};
+    assert(intRing.push_n(values, 6) == 6);
+    assert(intRing.pop_n(popped, 5) == 5);
+    assert(popped[0] == 0 && popped[4] == 4);
+    assert(intRing.push_n(values, 8) == 7);
+    assert(intRing.push_n(values, 1) == 0);
+    assert(intRing.pop_n(popped, 8) == 8);
+    assert(popped[0] == 5);
+    for (int i = 1; i < 8; ++i)
+    {
+        assert(popped[i] == i - 1);
+    }
+    assert(intRing.pop_n(popped, 8) == 0);
+    assert(intRing.is_empty());
+
+    // test transfer between two threads keeps order
+    constexpr std::uint64_t itemsCount = 200000;
+    spsc_ring<std::uint64_t, 64> threadRing;
+    std::thread producer([&threadRing]()
+    {
+        std::uint64_t batch[16];
+        std::uint64_t next = 0;
+        while (next < itemsCount)
+        {
+            const std::uint64_t count = std::min<std::uint64_t>(16, itemsCount - next);
+            for (std::uint64_t i = 0; i < count; ++i)
+            {
+                batch[i] = next + i;
+            }
+            const std::size_t pushed = threadRing.push_n(batch, count);
+            if (pushed == 0)
+            {
+                std::this_thread::yield();
+            }
+            next += pushed;
+        }
+    });
+
+    std::uint64_t expected = 0;
+    std::uint64_t batch[16];
+    while (expected < itemsCount)
+    {
+        const std::size_t count = threadRing.pop_n(batch, 16);
+        if (count == 0)
+        {
+            std::this_thread::yield();
+        }
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            assert(batch[i] == expected);
+            ++expected;
+        }
+    }
+    producer.join();
+    assert(threadRing.is_empty());
+}
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef TEST_STRIDED_VIEW_H
+#define TEST_STRIDED_VIEW_H
+
+#include <cassert>
+#include <algorithm>
+#include <numeric>
+
+#include "strided_view.h"
+
+void test_strided_view()
+{
+    my_vector<int> vec{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+    // test every other element
+    strided_view<int> evens(my_span<int>(vec), 2);
+    assert(evens.size() == 5);
+    assert(evens[4] == 8);
+    assert(evens.back() == 8);
+    assert(std::accumulate(evens.begin(), evens.end(), 0) == 20);
+    strided_view<int> odds(vec.data() + 1, 5, 2);
+    for (int& i : odds)
+    {
+        i = -i;
+    }
+    assert((vec == my_vector<int>{ 0, -1, 2, -3, 4, -5, 6, -7, 8, -9 }));
+
+    // test iterator arithmetic and algorithms
+    assert(evens.end() - evens.begin() == 5);
+    assert(*(2 + evens.begin()) == 4);
+    assert(evens.begin()[3] == 6);
+    assert(evens.begin() < evens.end());
+    std::reverse(evens.begin(), evens.end());
+    assert((vec == my_vector<int>{ 8, -1, 6, -3, 4, -5, 2, -7, 0, -9 }));
+
+    // test slicing and negative strides
+    strided_view<int> everyFourth = evens.slice(0, 3, 2);
+    assert(everyFourth.size() == 3);
+    assert(everyFourth.stride() == 4);
+    assert(everyFourth[2] == 0);
+    strided_view<int> backwards(vec.data() + 9, 10, -1);
+    assert(backwards[0] == -9);
+    assert(backwards.back() == 8);
+    assert(std::is_sorted(evens.begin(), evens.end(), std::greater<int>()));
+
+    my_array<int, 3> arr{ 1, 2, 3 };
+    strided_view<int> whole(my_span<int>(arr), 1);
+    assert(std::equal(whole.begin(), whole.end(), arr.begin(), arr.end()));
+    assert(strided_view<int>(my_span<int>(), 3).is_empty());
+}
+
+#endif
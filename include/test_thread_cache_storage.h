@@ -0,0 +1,89 @@
+#ifndef TEST_THREAD_CACHE_STORAGE_H
+#define TEST_THREAD_CACHE_STORAGE_H
+
+#include <string>
+#include <cassert>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+#include "thread_cache_storage.h"
+#include "my_vector.h"
+
+void test_thread_cache_storage()
+{
+    using cached_vector = my_vector<int, alignof(int), thread_cache_storage>;
+
+    // test size classes
+    assert(thread_cache_detail::class_index(64) == 0);
+    assert(thread_cache_detail::class_index(65) == 1);
+    assert(thread_cache_detail::class_index(thread_cache_max_block) == thread_cache_classes - 1);
+
+    // test a freed buffer is reused by the next allocation of its class
+    thread_cache_storage::trim();
+    const thread_cache_counters& stats = thread_cache_stats();
+    const int* firstBuffer = nullptr;
+    {
+        cached_vector vec(100, 7);
+        firstBuffer = vec.data();
+    }
+    assert(stats.cachedBytes >= 512);
+    const std::size_t misses = stats.misses;
+    {
+        cached_vector vec(120, 1);
+        assert(vec.data() == firstBuffer);
+        assert(reinterpret_cast<std::uintptr_t>(vec.data()) % cache_line_size == 0);
+    }
+    assert(stats.misses == misses);
+
+    // test growth works through the cache and keeps elements
+    my_vector<std::string, alignof(std::string), thread_cache_storage> strings;
+    for (int i = 0; i < 1000; ++i)
+    {
+        strings.push_back(std::to_string(i));
+    }
+    assert(strings.size() == 1000 && strings[999] == "999");
+    strings.shrink_to_fit();
+    assert(strings[0] == "0");
+
+    // test buffers larger than the biggest class or over-aligned bypass the cache
+    const std::size_t cachedBefore = stats.cachedBytes;
+    {
+        cached_vector large;
+        large.reserve(thread_cache_max_block);
+        my_vector<int, 128, thread_cache_storage> aligned;
+        aligned.reserve(10);
+    }
+    assert(stats.cachedBytes == cachedBefore);
+
+    // test the cache stays within its bound
+    for (int round = 0; round < 4; ++round)
+    {
+        my_vector<cached_vector> many;
+        for (int i = 0; i < 64; ++i)
+        {
+            many.push_back(cached_vector(thread_cache_max_block / sizeof(int) / 2, 0));
+        }
+    }
+    assert(stats.cachedBytes <= thread_cache_max_bytes);
+    assert(stats.releases > 0);
+
+    // test a buffer allocated on one thread can be freed and reused on another
+    cached_vector fromOtherThread;
+    std::thread producer([&fromOtherThread]()
+    {
+        fromOtherThread = cached_vector(1000, 3);
+    });
+    producer.join();
+    const int* foreignBuffer = fromOtherThread.data();
+    thread_cache_storage::trim();
+    fromOtherThread = cached_vector{};
+    cached_vector reused(1000, 4);
+    assert(reused.data() == foreignBuffer);
+    assert(reused[999] == 4);
+
+    thread_cache_storage::trim();
+    assert(stats.cachedBytes == 0);
+}
+
+#endif
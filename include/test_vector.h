@@ -5,7 +5,10 @@
 #include <cassert>
 #include <algorithm>
 #include <iostream>
+#include <iterator>
+#include <sstream>
 #include <numeric>
+#include <cstdint>
 
 #include "my_vector.h"
 
@@ -15,6 +18,11 @@ struct Test
     std::string b;
 };
 
+struct alignas(32) OverAligned
+{
+    int value;
+};
+
 void test_vector()
 {
     // test constructors/assignment operators
@@ -37,6 +45,16 @@ void test_vector()
     secondVec = { 1, 2, 3 };
     assert((secondVec == my_vector<int>{ 1, 2, 3 }));
 
+    // test single-pass input iterators, in the constructor and inserting in the middle
+    std::istringstream numbersStream("4 5 6");
+    const my_vector<int> streamed(std::istream_iterator<int>(numbersStream), std::istream_iterator<int>{});
+    assert((streamed == my_vector<int>{ 4, 5, 6 }));
+    std::istringstream moreStream("8 9");
+    auto inserted = secondVec.insert(secondVec.cbegin() + 1, std::istream_iterator<int>(moreStream), std::istream_iterator<int>{});
+    assert(inserted == secondVec.begin() + 1);
+    assert((secondVec == my_vector<int>{ 1, 8, 9, 2, 3 }));
+    secondVec = { 1, 2, 3 };
+
     // test comparison operators
     assert((my_vector<int>{ 1, 2, 3 } == my_vector<int>{ 1, 2, 3 }));
     assert((my_vector<int>{ 1, 3, 3 } != my_vector<int>{ 1, 2, 3 }));
@@ -275,6 +293,29 @@ void test_vector()
     assert(strVecIter == twoDimVec.end());
     concatenatedString = std::accumulate(twoDimVec[0].begin(), twoDimVec[0].end(), std::string(""));
     assert(concatenatedString == "1string");
+
+    // test aligned storage
+    static_assert(my_vector<int>::alignment == alignof(int));
+    static_assert(my_vector<char, 64>::alignment == 64);
+    static_assert(my_vector<OverAligned, 8>::alignment == 32);
+
+    my_vector<float, 64> alignedVec;
+    for (int i = 0; i < 100; ++i)
+    {
+        alignedVec.push_back(static_cast<float>(i));
+        assert(reinterpret_cast<std::uintptr_t>(alignedVec.data()) % 64 == 0);
+    }
+    assert(alignedVec.aligned_data()[99] == 99.0f);
+    assert((alignedVec == my_vector<float, 64>(alignedVec.begin(), alignedVec.end())));
+
+    my_vector<char, 4096> pageVec(10, 'x');
+    assert(reinterpret_cast<std::uintptr_t>(pageVec.data()) % 4096 == 0);
+    assert((pageVec == my_vector<char>(10, 'x')));
+
+    my_vector<OverAligned> overAlignedVec(3, OverAligned{ 7 });
+    overAlignedVec.emplace_back(OverAligned{ 8 });
+    assert(reinterpret_cast<std::uintptr_t>(overAlignedVec.data()) % 32 == 0);
+    assert(overAlignedVec[3].value == 8);
 }
 
 #endif
@@ -0,0 +1,170 @@
+#ifndef THREAD_CACHE_STORAGE_H
+#define THREAD_CACHE_STORAGE_H
+
+#include <cstddef>
+#include <algorithm>
+#include <bit>
+
+#include "cache_line.h"
+#include "my_array.h"
+#include "my_storage.h"
+
+// Size classes are the powers of two from one cache line up to 1 MiB.
+inline constexpr std::size_t thread_cache_min_block = cache_line_size;
+inline constexpr std::size_t thread_cache_max_block = std::size_t{ 1 } << 20;
+inline constexpr std::size_t thread_cache_classes = std::countr_zero(thread_cache_max_block / thread_cache_min_block) + 1;
+
+// Bytes a thread keeps in free lists before it hands freed blocks back to malloc.
+inline constexpr std::size_t thread_cache_max_bytes = std::size_t{ 8 } << 20;
+
+// Per-thread counters, read through thread_cache_stats() on the thread of interest.
+struct thread_cache_counters
+{
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+    std::size_t releases = 0;
+    std::size_t cachedBytes = 0;
+};
+
+namespace thread_cache_detail
+{
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    inline std::size_t class_index(std::size_t bytes)
+    {
+        return static_cast<std::size_t>(std::countr_zero(std::bit_ceil(bytes) / thread_cache_min_block));
+    }
+
+    inline std::size_t class_bytes(std::size_t index)
+    {
+        return thread_cache_min_block << index;
+    }
+
+    // Set once the thread's cache is destroyed, so vectors that outlive it at thread exit (other
+    // thread_locals, statics on the main thread) free straight to malloc.
+    inline thread_local bool cacheDestroyed = false;
+
+    struct ThreadCache
+    {
+        ~ThreadCache()
+        {
+            cacheDestroyed = true;
+            release_all();
+        }
+
+        void release_all()
+        {
+            for (std::size_t i = 0; i < thread_cache_classes; ++i)
+            {
+                while (heads[i] != nullptr)
+                {
+                    FreeBlock* block = heads[i];
+                    heads[i] = block->next;
+                    malloc_storage::deallocate(block, class_bytes(i), thread_cache_min_block);
+                    ++stats.releases;
+                }
+            }
+            stats.cachedBytes = 0;
+        }
+
+        my_array<FreeBlock*, thread_cache_classes> heads{};
+        thread_cache_counters stats;
+    };
+
+    inline ThreadCache& local_cache()
+    {
+        thread_local ThreadCache cache;
+        return cache;
+    }
+}
+
+inline const thread_cache_counters& thread_cache_stats()
+{
+    return thread_cache_detail::local_cache().stats;
+}
+
+// Keeps freed buffers in per-thread free lists, one per power-of-two size class, so a thread that
+// keeps creating and destroying vectors of similar capacity reuses its own blocks without
+// touching malloc or any lock. Every cached block is a plain cache-line aligned malloc_storage
+// block: a buffer freed on another thread than the one that allocated it simply joins the
+// freeing thread's cache, and a thread's cache is returned to malloc when the thread exits.
+// Requests above 1 MiB, of zero bytes or aligned beyond a cache line bypass the cache.
+struct thread_cache_storage
+{
+    static void* allocate(std::size_t bytes, std::size_t alignment)
+    {
+        if (!cacheable(bytes, alignment))
+        {
+            return malloc_storage::allocate(bytes, alignment);
+        }
+
+        const std::size_t index = thread_cache_detail::class_index(std::max(bytes, thread_cache_min_block));
+        if (thread_cache_detail::cacheDestroyed)
+        {
+            return malloc_storage::allocate(thread_cache_detail::class_bytes(index), thread_cache_min_block);
+        }
+
+        thread_cache_detail::ThreadCache& cache = thread_cache_detail::local_cache();
+        if (thread_cache_detail::FreeBlock* block = cache.heads[index])
+        {
+            cache.heads[index] = block->next;
+            cache.stats.cachedBytes -= thread_cache_detail::class_bytes(index);
+            ++cache.stats.hits;
+            return block;
+        }
+
+        ++cache.stats.misses;
+        return malloc_storage::allocate(thread_cache_detail::class_bytes(index), thread_cache_min_block);
+    }
+
+    static void deallocate(void* ptr, std::size_t bytes, std::size_t alignment)
+    {
+        if (ptr == nullptr)
+        {
+            return;
+        }
+        if (!cacheable(bytes, alignment))
+        {
+            malloc_storage::deallocate(ptr, bytes, alignment);
+            return;
+        }
+
+        const std::size_t index = thread_cache_detail::class_index(std::max(bytes, thread_cache_min_block));
+        const std::size_t blockBytes = thread_cache_detail::class_bytes(index);
+        if (thread_cache_detail::cacheDestroyed)
+        {
+            malloc_storage::deallocate(ptr, blockBytes, thread_cache_min_block);
+            return;
+        }
+
+        thread_cache_detail::ThreadCache& cache = thread_cache_detail::local_cache();
+        if (cache.stats.cachedBytes + blockBytes > thread_cache_max_bytes)
+        {
+            malloc_storage::deallocate(ptr, blockBytes, thread_cache_min_block);
+            ++cache.stats.releases;
+            return;
+        }
+
+        auto* block = static_cast<thread_cache_detail::FreeBlock*>(ptr);
+        block->next = cache.heads[index];
+        cache.heads[index] = block;
+        cache.stats.cachedBytes += blockBytes;
+    }
+
+    // Returns every block cached by the calling thread to malloc.
+    static void trim()
+    {
+        thread_cache_detail::local_cache().release_all();
+    }
+
+private:
+    static bool cacheable(std::size_t bytes, std::size_t alignment)
+    {
+        return bytes != 0 && bytes <= thread_cache_max_block && alignment <= thread_cache_min_block;
+    }
+};
+
+#endif
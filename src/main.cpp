@@ -1,10 +1,62 @@
 #include "test_array.h"
 #include "test_vector.h"
+#include "test_flat_map.h"
+#include "test_flat_set.h"
+#include "test_spsc_ring.h"
+#include "test_mpmc_queue.h"
+#include "test_huge_page_storage.h"
+#include "test_persistent_vector.h"
+#include "test_cow_vector.h"
+#include "test_my_span.h"
+#include "test_strided_view.h"
+#include "test_my_mdspan.h"
+#include "test_my_ranges.h"
+#include "test_my_sort.h"
+#include "test_open_hash_set.h"
+#include "test_set_ops.h"
+#include "test_gather_scatter.h"
+#include "test_thread_cache_storage.h"
+#include "test_my_vector_trace.h"
+#include "test_my_vector_profile.h"
+#include "test_devector.h"
+#include "test_ring_vector.h"
+#include "test_gap_vector.h"
+#include "test_my_vector_hardening.h"
+#include "test_my_vector_layout.h"
+#include "test_jagged_vector.h"
+#include "test_prefault.h"
+#include "test_async_fill.h"
 
 int main()
 {
     test_array();
     test_vector();
+    test_flat_map();
+    test_flat_set();
+    test_spsc_ring();
+    test_mpmc_queue();
+    test_huge_page_storage();
+    test_persistent_vector();
+    test_cow_vector();
+    test_my_span();
+    test_strided_view();
+    test_my_mdspan();
+    test_my_ranges();
+    test_my_sort();
+    test_open_hash_set();
+    test_set_ops();
+    test_gather_scatter();
+    test_thread_cache_storage();
+    test_my_vector_trace();
+    test_my_vector_profile();
+    test_devector();
+    test_ring_vector();
+    test_gap_vector();
+    test_my_vector_hardening();
+    test_my_vector_layout();
+    test_jagged_vector();
+    test_prefault();
+    test_async_fill();
 
     return 0;
 }
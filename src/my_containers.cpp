@@ -0,0 +1,6 @@
+#include "my_containers_extern.h"
+
+// The one place the common my_vector specializations are instantiated; see my_containers_extern.h.
+#define MY_CONTAINERS_INSTANTIATE(T) template class my_vector<T>;
+MY_CONTAINERS_ELEMENT_TYPES(MY_CONTAINERS_INSTANTIATE)
+#undef MY_CONTAINERS_INSTANTIATE
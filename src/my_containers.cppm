@@ -0,0 +1,53 @@
+module;
+
+#include "my_storage.h"
+#include "default_storage.h"
+#include "my_array.h"
+#include "my_vector.h"
+#include "my_span.h"
+#include "strided_view.h"
+#include "my_mdspan.h"
+#include "devector.h"
+#include "ring_vector.h"
+#include "gap_vector.h"
+#include "cow_vector.h"
+#include "flat_map.h"
+#include "flat_set.h"
+
+// C++20 module interface over the container headers: import my_containers; instead of the
+// #includes. The headers stay the source of truth, this only re-exports their public names.
+export module my_containers;
+
+export using ::malloc_storage;
+export using ::default_storage;
+
+export using ::my_array;
+export using ::my_array_out_of_range;
+
+export using ::my_vector;
+export using ::my_vector_out_of_range;
+export using ::my_vector_length_error;
+export using ::wide_layout;
+export using ::compact_layout;
+export using ::thin_layout;
+export using ::compact_vector;
+export using ::thin_vector;
+
+export using ::dynamic_extent;
+export using ::my_span;
+export using ::strided_view;
+export using ::layout_right;
+export using ::layout_left;
+export using ::my_mdspan;
+
+export using ::devector;
+export using ::ring_vector;
+export using ::overwrite_oldest_t;
+export using ::overwrite_oldest;
+export using ::gap_vector;
+export using ::cow_vector;
+
+export using ::flat_map;
+export using ::flat_map_out_of_range;
+export using ::flat_map_size_mismatch;
+export using ::flat_set;